@@ -33,6 +33,7 @@
 #include "clock.h"
 #include "compiler.h"
 #include "cpu.h"
+#include "tsc.h"
 
 #include "concurrency_control/include/epoch.h"
 #include "concurrency_control/include/session.h"
@@ -65,6 +66,7 @@ void worker(std::atomic<bool>& quit) {
 
     // prepare result
     std::size_t ct_commit{0};
+    std::uint64_t commit_cycles{0};
 
     // loop exp
     while (!quit.load(std::memory_order_acquire)) {
@@ -74,7 +76,9 @@ void worker(std::atomic<bool>& quit) {
             auto rc = upsert(token, st, k, "v");
             if (rc != Status::OK) { LOG(FATAL); }
         }
+        auto start{rdtscp()};
         auto rc{commit(token)}; // NOLINT
+        commit_cycles += rdtscp() - start;
         if (rc != Status::OK) { LOG(FATAL); }
         ++ct_commit;
     }
@@ -83,6 +87,10 @@ void worker(std::atomic<bool>& quit) {
     std::uint64_t committed_ops = ct_commit * FLAGS_ops;
     std::uint64_t opsps = committed_ops / FLAGS_d;
     std::cout << "Throughput[ops/s]: " << opsps << std::endl;
+    if (committed_ops > 0) {
+        std::cout << "Commit[cycles/record]: " << commit_cycles / committed_ops
+                  << std::endl;
+    }
 
     // cleanup
     leave(token);
@@ -53,6 +53,7 @@
  */
 DEFINE_uint64(cr, 0, "conflict rate. [0:100] %.");        // NOLINT
 DEFINE_uint64(d, 1, "Duration of benchmark in seconds."); // NOLINT
+DEFINE_uint64(rr, 0, "read rate. [0:100] %.");            // NOLINT
 
 using namespace shirakami;
 
@@ -103,6 +104,7 @@ void worker(const std::size_t thid, const bool is_ol, char& ready,
 
     std::size_t ct_abort{0};
     std::size_t ct_commit{0};
+    std::size_t ct_read{0};
 
     storeRelease(ready, 1);
     while (!loadAcquire(start)) { _mm_pause(); }
@@ -126,8 +128,22 @@ void worker(const std::size_t thid, const bool is_ol, char& ready,
 
     RETRY: // NOLINT
         std::size_t st_ct{0};
+        std::size_t read_ct{0};
         for (auto&& itr : opr_set) {
             Status rc{};
+            if (FLAGS_rr > (rnd.next() % 100)) { // NOLINT
+                // ltx read
+                std::string vb{};
+                rc = search_key(token, st_list.at(st_ct), itr.get_key(), vb);
+                if (rc == Status::WARN_PREMATURE) {
+                    goto RETRY; // NOLINT
+                }
+                if (rc != Status::OK && rc != Status::WARN_NOT_FOUND) {
+                    LOG_FIRST_N(ERROR, 1)
+                            << log_location_prefix << "ec: " << rc << std::endl;
+                }
+                ++read_ct;
+            }
             if (itr.get_type() == OP_TYPE::UPDATE) {
                 // update function is not implemented yet.
                 rc = upsert(token, st_list.at(st_ct), itr.get_key(),
@@ -150,10 +166,12 @@ void worker(const std::size_t thid, const bool is_ol, char& ready,
             LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path.";
         }
         ++ct_commit;
+        ct_read += read_ct;
     }
 
     leave(token);
     res.set_ct_commit(ct_commit);
+    res.set_ct_read(ct_read);
 }
 
 void invoke_leader() {
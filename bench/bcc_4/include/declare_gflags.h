@@ -12,3 +12,4 @@
  */
 DECLARE_uint64(cr);
 DECLARE_uint64(d);
+DECLARE_uint64(rr);
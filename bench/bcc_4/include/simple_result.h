@@ -13,12 +13,17 @@ public:
 
     [[nodiscard]] std::uint64_t get_ct_commit() const { return ct_commit_; }
 
+    [[nodiscard]] std::uint64_t get_ct_read() const { return ct_read_; }
+
     // setter
     void set_ct_abort(std::uint64_t ct) { ct_abort_ = ct; }
 
     void set_ct_commit(std::uint64_t ct) { ct_commit_ = ct; }
 
+    void set_ct_read(std::uint64_t ct) { ct_read_ = ct; }
+
 private:
     std::uint64_t ct_abort_{0};
     std::uint64_t ct_commit_{0};
+    std::uint64_t ct_read_{0};
 };
@@ -27,15 +27,26 @@ void check_flags() {
     } else {
         LOG_FIRST_N(ERROR, 1);
     }
+    if (0 <= FLAGS_rr && FLAGS_rr <= 100) { // NOLINT
+        std::cout << "FLAGS_rr:\t" << FLAGS_rr << std::endl;
+    } else {
+        LOG_FIRST_N(ERROR, 1);
+    }
     printf("Fin check_flags()\n"); // NOLINT
 }
 
 void output_result(std::vector<simple_result> const& res_bt) {
     std::uint64_t bt_ct_commit{0};
-    for (auto&& elem : res_bt) { bt_ct_commit += elem.get_ct_commit(); }
+    std::uint64_t bt_ct_read{0};
+    for (auto&& elem : res_bt) {
+        bt_ct_commit += elem.get_ct_commit();
+        bt_ct_read += elem.get_ct_read();
+    }
     std::cout << "bt_throughput[tps]:\t" << bt_ct_commit / FLAGS_d << std::endl;
     std::cout << "bt_throughput[ops/s]:\t" << (bt_ct_commit * tx_size) / FLAGS_d
               << std::endl;
+    std::cout << "bt_read_throughput[ops/s]:\t" << bt_ct_read / FLAGS_d
+              << std::endl;
 
     shirakami::displayRusageRUMaxrss();
 }
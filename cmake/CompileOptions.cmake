@@ -146,6 +146,12 @@ else ()
     add_definitions(-DPARAM_RETRY_READ=${PARAM_RETRY_READ})
 endif ()
 
+if (NOT DEFINED PARAM_COMMIT_PREFETCH_DISTANCE)
+    add_definitions(-DPARAM_COMMIT_PREFETCH_DISTANCE=8)
+else ()
+    add_definitions(-DPARAM_COMMIT_PREFETCH_DISTANCE=${PARAM_COMMIT_PREFETCH_DISTANCE})
+endif ()
+
 if (NOT DEFINED PARAM_SNAPSHOT_EPOCH)
     add_definitions(-DPARAM_SNAPSHOT_EPOCH=25)
 else ()
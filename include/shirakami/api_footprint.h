@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string_view>
+
+#include "scheme.h"
+#include "transaction_options.h"
+
+namespace shirakami {
+
+/**
+ * @brief get the write footprint recorded for @a label.
+ * @details The footprint is the storages and the key ranges which the LONG
+ * transactions begun with transaction_options::set_label wrote. It is
+ * recorded when the transaction commits or is aborted by the user, so a
+ * dry run which is aborted after its writes records it too. The key which
+ * was rejected by Status::WARN_WRITE_WITHOUT_WP is also added. The ranges
+ * of the runs are merged, so the footprint covers all of them.
+ * @param[in] label The label of the transactions.
+ * @param[out] out The footprint in the form of write preserve range.
+ * @return Status::OK success.
+ * @return Status::WARN_NOT_FOUND No footprint is recorded for @a label.
+ */
+Status get_write_footprint(
+        std::string_view label,
+        transaction_options::write_preserve_range_type& out);
+
+/**
+ * @brief set the write footprint recorded for the label of @a options as
+ * its write preserve range.
+ * @details The storages in the write preserve of @a options are still
+ * preserved as a whole.
+ * @param[in,out] options The options which has the label.
+ * @return Status::OK success.
+ * @return Status::WARN_NOT_FOUND No footprint is recorded for the label.
+ * @a options is not changed.
+ */
+Status apply_write_footprint(transaction_options& options);
+
+/**
+ * @brief clear the write footprint recorded for @a label.
+ * @details Use this when the write pattern of the transactions changed and
+ * the merged footprint became too broad.
+ * @param[in] label The label of the transactions.
+ * @return Status::OK success.
+ * @return Status::WARN_NOT_FOUND No footprint is recorded for @a label.
+ */
+Status clear_write_footprint(std::string_view label);
+
+} // namespace shirakami
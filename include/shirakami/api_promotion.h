@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "scheme.h"
+#include "transaction_options.h"
+
+namespace shirakami {
+
+/**
+ * @brief statistics about the transactions which have the same label.
+ * @details The engine tracks the results of the transactions begun with
+ * transaction_options::set_label when SHIRAKAMI_OCC_PROMOTION_THRESHOLD is
+ * set. It shows the effect of the promotion by comparing the counts before
+ * and after the promotion.
+ */
+struct promotion_stats {
+    /**
+     * @brief whether the transactions with the label were promoted to LONG.
+     */
+    bool promoted_{};
+
+    /**
+     * @brief the number of the consecutive aborts of SHORT by read verify or
+     * wp verify.
+     */
+    std::uint64_t consecutive_aborts_{};
+
+    /**
+     * @brief the number of committed SHORT.
+     */
+    std::uint64_t short_commits_{};
+
+    /**
+     * @brief the number of aborted SHORT at commit.
+     */
+    std::uint64_t short_aborts_{};
+
+    /**
+     * @brief the number of committed LONG.
+     */
+    std::uint64_t long_commits_{};
+
+    /**
+     * @brief the number of aborted LONG at commit.
+     */
+    std::uint64_t long_aborts_{};
+
+    /**
+     * @brief the number of the demotions from LONG to SHORT.
+     */
+    std::uint64_t demotions_{};
+
+    /**
+     * @brief the number of SHORT which tx_begin began as LONG by
+     * SHIRAKAMI_OCC_AUTO_PROMOTION.
+     */
+    std::uint64_t auto_promoted_begins_{};
+};
+
+/**
+ * @brief recommend the transaction options for the label of @a options.
+ * @details If the SHORT transactions with the label aborted by
+ * reason_code::CC_OCC_READ_VERIFY or reason_code::CC_OCC_WP_VERIFY
+ * SHIRAKAMI_OCC_PROMOTION_THRESHOLD times in a row, this sets LONG and the
+ * write preserve inferred from their write sets to @a options. The
+ * promotion is dropped if LONG with the label also aborts as many times in a
+ * row, or commits SHIRAKAMI_OCC_PROMOTION_DECAY times.
+ * @param[in,out] options The options which has the label.
+ * @return Status::OK @a options was promoted.
+ * @return Status::WARN_NOT_FOUND There is no recommendation. @a options is not
+ * changed.
+ */
+Status recommend_transaction_options(transaction_options& options);
+
+/**
+ * @brief get the statistics about the transactions which have @a label.
+ * @param[in] label The label of the transactions.
+ * @param[out] out The statistics.
+ * @return Status::OK success.
+ * @return Status::WARN_NOT_FOUND There is no transaction with the label.
+ */
+Status get_promotion_stats(std::string_view label, promotion_stats& out);
+
+} // namespace shirakami
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "scheme.h"
+
+namespace shirakami {
+
+/**
+ * @brief The position of the snapshot which a rtx barrier waits for. It is an
+ * epoch number.
+ */
+using rtx_barrier_anchor_type = std::uint64_t;
+
+/**
+ * @brief The callback called when the rtx barrier was released.
+ * @details The argument is Status::OK if the barrier was released, or
+ * Status::WARN_NOT_INIT if the database was shut down before that.
+ */
+using rtx_barrier_callback_type = std::function<void(Status)>;
+
+/**
+ * @brief acquire a barrier for read only transactions.
+ * @details The barrier ensures that the read only transactions which begin
+ * after the barrier was released read all the transactions committed before
+ * the barrier was acquired.
+ * @param[out] anchor The snapshot position of the barrier.
+ * @return Status::OK success.
+ */
+Status acquire_rtx_barrier(rtx_barrier_anchor_type& anchor);
+
+/**
+ * @brief check whether the barrier was released.
+ * @param[in] anchor The snapshot position acquired by acquire_rtx_barrier.
+ * @param[out] released Whether the barrier was released.
+ * @return Status::OK success.
+ */
+Status check_rtx_barrier(rtx_barrier_anchor_type anchor, bool& released);
+
+/**
+ * @brief wait until the barrier is released.
+ * @attention If there are running long transactions, this may wait until
+ * they finish.
+ * @param[in] anchor The snapshot position acquired by acquire_rtx_barrier.
+ * @return Status::OK the barrier was released.
+ * @return Status::WARN_NOT_INIT the database was shut down before the
+ * barrier was released.
+ */
+Status wait_rtx_barrier(rtx_barrier_anchor_type anchor);
+
+/**
+ * @brief register the callback called when the barrier is released.
+ * @details If the barrier was already released, the callback is called by
+ * this thread before this returns. Otherwise, it is called by the epoch
+ * thread, so it should not block.
+ * @param[in] anchor The snapshot position acquired by acquire_rtx_barrier.
+ * @param[in] callback The callback.
+ * @return Status::OK success.
+ */
+Status wait_rtx_barrier(rtx_barrier_anchor_type anchor,
+                        rtx_barrier_callback_type callback);
+
+} // namespace shirakami
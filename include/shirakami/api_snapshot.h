@@ -0,0 +1,30 @@
+#pragma once
+
+#include "scheme.h"
+
+namespace shirakami {
+
+/**
+ * @brief open a snapshot shared among read only transactions.
+ * @details The snapshot is decided in the same manner as the read only
+ * transaction which begins now. The read only transactions which begin with
+ * transaction_options::set_snapshot read this snapshot, and the versions
+ * resolved by one of them are reused by the others. The versions in the
+ * snapshot are not collected by gc until the snapshot is closed and all the
+ * attached transactions finish.
+ * @param[out] handle The handle of the snapshot.
+ * @return Status::OK success.
+ */
+Status open_snapshot(SnapshotHandle& handle);
+
+/**
+ * @brief close the snapshot opened by open_snapshot.
+ * @details The read only transactions attached to the snapshot can continue
+ * to read it until they finish. New transactions can't be attached to it.
+ * @param[in] handle The handle of the snapshot.
+ * @return Status::OK success.
+ * @return Status::WARN_INVALID_HANDLE @a handle is not an opened snapshot.
+ */
+Status close_snapshot(SnapshotHandle handle);
+
+} // namespace shirakami
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -8,6 +10,15 @@
 
 namespace shirakami {
 
+/**
+ * @brief merge operator for merge().
+ * @details It combines the value of the record @a existing and the operand
+ * given by merge() into @a out. It is called at commit phase while the record
+ * is locked, so it must be deterministic and must not call shirakami api.
+ */
+using merge_operator_type = std::function<void(
+        std::string_view existing, std::string_view operand, std::string& out)>;
+
 /**
  * @brief Create one table by using key, and return its handler.
  * @param key The storage's key. It also can be used for get_storage.
@@ -37,6 +48,20 @@ Status create_storage(std::string_view key, Storage& storage,
  */
 Status delete_storage(Storage storage);
 
+/**
+ * @brief delete existing storage and records under the storage.
+ * @details If @a async is true, the records under the storage are released in
+ * the background by gc after the transactions which may see them finished,
+ * so this returns without waiting for the release.
+ * @param[in] storage the storage handle retrieved with create_storage().
+ * @param[in] async whether the records are released in the background.
+ * @return Status::OK if successful.
+ * @return Status::WARN_INVALID_HANDLE if the storage is not registered with
+ * the given name.
+ * @return Status::ERR_FATAL Some programming error.
+ */
+Status delete_storage(Storage storage, bool async);
+
 /**
  * @brief Get the storage handle by using key.
  * @param[in] key The key of the target storage handle.
@@ -79,4 +104,33 @@ Status storage_get_options(Storage storage, storage_option& options);
  */
 Status storage_set_options(Storage storage, storage_option const& options);
 
+/**
+ * @brief Remove all the records under the storage.
+ * @details It replaces the index of the storage with the empty one at once
+ * without visiting the records, and the removed records are released in the
+ * background by gc. The storage handle, its options and its write preserve
+ * are kept. For the durable storage, it returns after the current epoch
+ * passed, so that the records written after this are not removed by the
+ * recovery.
+ * @param[in] storage the storage handle retrieved with create_storage().
+ * @pre No transaction accesses @a storage concurrently. Transactions which
+ * read or wrote @a storage before this are not aborted by this.
+ * @return Status::OK success.
+ * @return Status::WARN_INVALID_HANDLE @a storage is not found.
+ * @return Status::ERR_FATAL Some programming error.
+ */
+Status truncate_storage(Storage storage);
+
+/**
+ * @brief Register the merge operator used by merge() for the storage.
+ * @details It overwrites the merge operator registered before. Merges which
+ * were already executed keep using the operator at the time.
+ * @param[in] storage the storage handle.
+ * @param[in] op the merge operator.
+ * @return Status::OK success.
+ * @return Status::WARN_INVALID_ARGS @a op is empty.
+ * @return Status::WARN_NOT_FOUND The storage was not found.
+ */
+Status register_merge_operator(Storage storage, merge_operator_type op);
+
 } // namespace shirakami
@@ -5,11 +5,16 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include "api_diagnostic.h"
+#include "api_footprint.h"
 #include "api_result.h"
+#include "api_rtx_barrier.h"
+#include "api_promotion.h"
 #include "api_sequence.h"
+#include "api_snapshot.h"
 #include "api_storage.h"
 #include "api_tx_id.h"
 #include "database_options.h"
@@ -37,6 +42,33 @@ namespace shirakami {
  */
 Status abort(Token token); // NOLINT
 
+/**
+ * @brief load records into the empty storage at once.
+ * @details This is for initial population of the storage. It puts all the
+ * records without read / write set and makes them visible at one timestamp,
+ * so the cost per record is much lower than insert in short transactions.
+ * @param[in] token the token retrieved by enter(). It must not be in a
+ * transaction.
+ * @param[in] storage the storage to be loaded. It must be empty.
+ * @param[in] keys the array of the keys of @a size elements. It must be sorted
+ * in strictly ascending order.
+ * @param[in] values the array of the values of @a size elements.
+ * @param[in] size the number of the records.
+ * @return Status::OK success. The loaded records are durable when the epoch
+ * of this operation becomes durable.
+ * @return Status::WARN_ALREADY_BEGIN The token is in a transaction.
+ * @return Status::WARN_ALREADY_EXISTS The storage is not empty or some key
+ * was inserted by the other transaction concurrently. No record is loaded.
+ * @return Status::WARN_ILLEGAL_OPERATION Some long transaction declared write
+ * preserve for the storage before or during the load. No record is loaded.
+ * @return Status::WARN_INVALID_ARGS The keys are not sorted in strictly
+ * ascending order.
+ * @return Status::WARN_INVALID_KEY_LENGTH Some key is too long.
+ * @return Status::WARN_STORAGE_NOT_FOUND @b storage is not found.
+ */
+Status bulk_load(Token token, Storage storage, std::string_view const* keys,
+                 std::string_view const* values, std::size_t size);
+
 /**
  * @brief close the scan which was opened at open_scan.
  * @param[in] token the token retrieved by enter().
@@ -80,6 +112,27 @@ bool commit(Token token, commit_callback_type callback);
  */
 Status commit(Token token); // NOLINT
 
+/**
+ * @brief commit multiple short transactions in one call.
+ * @details Each transaction is validated and committed independently in the
+ * order of @a requests, and its result is notified by the callback of the
+ * same request in the same manner as commit(Token, commit_callback_type).
+ * The batch shares the work which each commit does on its own: the short
+ * expose lock which blocks the start of long and read only transactions is
+ * taken once, and the log records of all the transactions are put into one
+ * session of the log channel and flushed once.
+ * @param requests the pairs of the transaction control handle retrieved with
+ * enter() and the callback invoked when (pre-)commit of the transaction
+ * completes. Each callback is called exactly once by the end of this
+ * function call. It receives the status described at
+ * commit(Token, commit_callback_type), and Status::WARN_ILLEGAL_OPERATION if
+ * the transaction is not a short transaction. If some token appears more than
+ * once, no transaction is committed and every callback receives
+ * Status::WARN_INVALID_ARGS.
+ */
+void commit_batch(
+        std::vector<std::pair<Token, commit_callback_type>> const& requests);
+
 /**
  * @brief delete the record for the given key
  * @param[in] token the token retrieved by enter()
@@ -112,6 +165,40 @@ Status commit(Token token); // NOLINT
 Status delete_record(Token token, Storage storage, // NOLINT
                      std::string_view key);
 
+/**
+ * @brief It deletes all records in the range.
+ * @details It has the same effect as delete_record() for each existing key
+ * in the range, but it walks the index once and doesn't go through the scan
+ * handle or register the records to the read set. The range is protected
+ * against phantoms in the same way as open_scan(). This is only for short
+ * transaction.
+ * @param[in] token the token retrieved by enter()
+ * @param[in] storage the handle of storage.
+ * @param[in] l_key the key to indicate the beginning of the range.
+ * @param[in] l_end the end point of the beginning of the range.
+ * @param[in] r_key the key to indicate the end of the range.
+ * @param[in] r_end the end point of the end of the range.
+ * @return Status::OK success. One or more records were deleted.
+ * @return Status::WARN_CONFLICT_ON_WRITE_PRESERVE Some long transaction
+ * declared write preserve which overlaps the range. No record is deleted.
+ * @return Status::WARN_ILLEGAL_OPERATION This transaction is not short
+ * transaction.
+ * @return Status::WARN_NOT_BEGIN The transaction is not began.
+ * @return Status::WARN_NOT_FOUND There are no records in the range.
+ * @return Status::WARN_STORAGE_NOT_FOUND @a storage is not found.
+ * @return Status::ERR_CC Error about concurrency control.
+ * @note If a record in the range is deleted by others before commit, commit
+ * fails with Status::ERR_KVS and reason_code::KVS_DELETE in the same manner as
+ * delete_record().
+ * @attention It doesn't write a range tombstone. Each record in the range
+ * still gets its own write set entry, log record and gc visit, so the cost
+ * grows with the number of the records in the range. Use truncate_storage() to
+ * remove all the records of a storage at once.
+ */
+Status delete_range(Token token, Storage storage, std::string_view l_key,
+                    scan_endpoint l_end, std::string_view r_key,
+                    scan_endpoint r_end);
+
 /**
  * @brief enter session
  * @param[out] token output parameter to return the token
@@ -233,6 +320,33 @@ Status insert(Token token, Storage storage,
  */
 Status leave(Token token); // NOLINT
 
+/**
+ * @brief It merges the operand into the record for the given key.
+ * @details The merge operator registered by register_merge_operator() for
+ * @a storage is applied to the value of the record at commit phase while the
+ * record is locked. It doesn't register a read, so concurrent merges to the
+ * same record don't conflict each other. Reading the key after this operation
+ * in the same transaction reads the record and it is verified at commit.
+ * This is only for short transaction.
+ * @param[in] token the token retrieved by enter()
+ * @param[in] storage the handle of storage.
+ * @param[in] key the key of the merged record
+ * @param[in] operand the operand given to the merge operator
+ * @return Status::OK Success.
+ * @return Status::WARN_ILLEGAL_OPERATION This transaction is not short
+ * transaction.
+ * @return Status::WARN_INVALID_ARGS The merge operator is not registered for
+ * @a storage.
+ * @return Status::WARN_INVALID_KEY_LENGTH The @a key is invalid. Key length
+ * should be equal or less than 30KB.
+ * @return Status::WARN_NOT_BEGIN The transaction was not begun.
+ * @return Status::WARN_NOT_FOUND The record is not found.
+ * @note If the record is deleted before commit, commit fails with
+ * Status::ERR_KVS and reason_code::KVS_UPDATE.
+ */
+Status merge(Token token, Storage storage, std::string_view key,
+             std::string_view operand);
+
 /**
  * @brief start scan and return the scan handle for the specified range.
  * @details This function preserve the specified range of masstree. If you use ltx
@@ -374,6 +488,34 @@ Status read_value_from_scan(Token token, ScanHandle handle, std::string& value);
 Status search_key(Token token, Storage storage, std::string_view key,
                   std::string& value); // NOLINT
 
+/**
+ * @brief It searches with the given keys in the same storage.
+ * @details It has the same effect as search_key() for each key in order, but
+ * the checks about the storage are done once, and the index probes of a group
+ * of keys are done before reading the records so that their cache misses
+ * overlap.
+ * @param[in] token the token retrieved by enter()
+ * @param[in] storage the handle of storage.
+ * @param[in] keys the search keys. It has @a size elements.
+ * @param[out] values the found values. It has @a size elements. The element
+ * whose status is not Status::OK is not changed.
+ * @param[out] statuses the result of each key, which is the same as the
+ * return value of search_key(). It has @a size elements.
+ * @param[in] size the number of the keys.
+ * @return Status::OK All keys were searched. See @a statuses.
+ * @return Status::WARN_NOT_BEGIN The transaction was not begun.
+ * @return Status::WARN_STORAGE_NOT_FOUND @a storage is not found. All
+ * elements of @a statuses are set to it.
+ * @return Status::ERR_CC Error about concurrency control. The elements of
+ * @a statuses after the failed key are not set.
+ * @note The write preserves are checked key by key, so a write preserve on
+ * the range between the keys doesn't abort this.
+ * @return Status::ERR_READ_AREA_VIOLATION error about read area.
+ */
+Status search_key_batch(Token token, Storage storage,
+                        std::string_view const* keys, std::string* values,
+                        Status* statuses, std::size_t size);
+
 /**
  * @brief Transaction begins.
  * @attention This function must be called before requesting any other operation
@@ -423,6 +565,31 @@ Status update(Token token, Storage storage, std::string_view key, std::string_vi
               blob_id_type const* blobs_data = nullptr,
               std::size_t blobs_size = 0);
 
+/**
+ * @brief It updates the record for the given key if the value of the record
+ * is @a expected at commit.
+ * @details The value is compared at commit phase while the record is locked.
+ * It doesn't register a read, so it succeeds even if the record was
+ * overwritten by the same value concurrently. This is only for short
+ * transaction.
+ * @param[in] token the token retrieved by enter()
+ * @param[in] storage the handle of storage.
+ * @param[in] key the key of the updated record
+ * @param[in] expected the value which the record must have at commit
+ * @param[in] val the value of the updated record
+ * @return Status::OK Success.
+ * @return Status::WARN_ILLEGAL_OPERATION This transaction is not short
+ * transaction, or it already wrote the record.
+ * @return Status::WARN_INVALID_KEY_LENGTH The @a key is invalid. Key length
+ * should be equal or less than 30KB.
+ * @return Status::WARN_NOT_BEGIN The transaction was not begun.
+ * @return Status::WARN_NOT_FOUND The record is not found.
+ * @note If the value doesn't match at commit, commit fails with
+ * Status::ERR_KVS and reason_code::KVS_UPDATE_IF_MISMATCH.
+ */
+Status update_if(Token token, Storage storage, std::string_view key,
+                 std::string_view expected, std::string_view val);
+
 /**
  * @brief update the record for the given key, or insert the key/value if the
  * record does not exist
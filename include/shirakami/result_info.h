@@ -69,6 +69,17 @@ enum class reason_code : std::int32_t {
      * @brief After abort command by user.
      */
     USER_ABORT,
+    /**
+     * @brief Occ tx gave up acquiring write lock at commit phase due to
+     * contention. It is only for bounded spin or no-wait lock contention
+     * policy.
+     */
+    CC_OCC_WRITE_LOCK_CONTENTION,
+    /**
+     * @brief The value of the record did not match the expected value of
+     * update_if at commit phase.
+     */
+    KVS_UPDATE_IF_MISMATCH,
 };
 
 inline constexpr std::string_view to_string_view(reason_code rc) noexcept {
@@ -98,6 +109,10 @@ inline constexpr std::string_view to_string_view(reason_code rc) noexcept {
             return "CC_OCC_PHANTOM_AVOIDANCE"sv;
         case reason_code::USER_ABORT:
             return "USER_ABORT"sv;
+        case reason_code::CC_OCC_WRITE_LOCK_CONTENTION:
+            return "CC_OCC_WRITE_LOCK_CONTENTION"sv;
+        case reason_code::KVS_UPDATE_IF_MISMATCH:
+            return "KVS_UPDATE_IF_MISMATCH"sv;
     }
     std::abort();
 }
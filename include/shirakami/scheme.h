@@ -32,6 +32,12 @@ using Token = void*;
  */
 using ScanHandle = void*;
 
+/**
+ * @brief Snapshot Handle
+ * @details The snapshot shared among read only transactions.
+ */
+using SnapshotHandle = void*;
+
 enum class scan_endpoint : char {
     EXCLUSIVE,
     INCLUSIVE,
@@ -43,16 +43,29 @@ public:
 
     [[nodiscard]] std::string_view payload() const { return payload_; }
 
+    /**
+     * @brief set whether the storage is durable.
+     * @details The writes to the non-durable storage are not logged, and the
+     * storage and its records are absent after recovery. It is fixed at
+     * create_storage and storage_set_options doesn't change it.
+     */
+    void durable(bool tf) { durable_ = tf; }
+
+    [[nodiscard]] bool durable() const { return durable_; }
+
 private:
     id_t id_{storage_id_undefined};
 
     std::string payload_{};
+
+    bool durable_{true};
 };
 
 inline std::ostream& operator<<(std::ostream& out,
                                 storage_option const& options) {
     out << "storage_option: id: " << std::to_string(options.id())
-        << ", payload: " << shirakami_binstring(options.payload());
+        << ", payload: " << shirakami_binstring(options.payload())
+        << ", durable: " << options.durable();
     return out;
 }
 
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <vector>
 
 #include "logging.h"
@@ -15,6 +18,13 @@ class transaction_options final {
 public:
     using write_preserve_type = std::vector<Storage>;
 
+    /**
+     * @brief First is the storage, second is the left key and third is the
+     * right key of the range. Both ends are inclusive.
+     */
+    using write_preserve_range_type =
+            std::vector<std::tuple<Storage, std::string, std::string>>;
+
     enum class transaction_type : std::int32_t {
         /**
          * @brief It is optimized for long transaction which its abort rate is
@@ -97,10 +107,34 @@ public:
         return write_preserve_;
     }
 
+    [[nodiscard]] write_preserve_range_type get_write_preserve_range() const {
+        return write_preserve_range_;
+    }
+
     [[nodiscard]] read_area get_read_area() const { return read_area_; }
 
+    [[nodiscard]] SnapshotHandle get_snapshot() const { return snapshot_; }
+
+    [[nodiscard]] std::string const& get_label() const { return label_; }
+
     void set_read_area(read_area const& ra) { read_area_ = ra; }
 
+    void set_snapshot(SnapshotHandle const sh) { snapshot_ = sh; }
+
+    /**
+     * @brief set the label which identifies the kind of the transaction.
+     * @details If SHIRAKAMI_OCC_PROMOTION_THRESHOLD is set, the results of the
+     * SHORT transactions are tracked per label. If SHIRAKAMI_OCC_AUTO_PROMOTION
+     * is also set, tx_begin() begins the SHORT transaction of the promoted
+     * label as LONG with the inferred write preserve.
+     * @attention The auto promoted transaction behaves as LONG, so the
+     * operations may return Status::WARN_PREMATURE until its epoch comes, and
+     * commit() may return Status::WARN_WAITING_FOR_OTHER_TX. The number of
+     * them is shown by promotion_stats::auto_promoted_begins_ of
+     * get_promotion_stats().
+     */
+    void set_label(std::string_view const label) { label_ = label; }
+
     void set_token(Token token) { token_ = token; }
 
     void set_transaction_type(transaction_type tt) { transaction_type_ = tt; }
@@ -109,6 +143,10 @@ public:
         write_preserve_ = wp;
     }
 
+    void set_write_preserve_range(write_preserve_range_type const& wpr) {
+        write_preserve_range_ = wpr;
+    }
+
 private:
     /**
      * @brief This is a transaction executor information got from enter command.
@@ -137,6 +175,17 @@ private:
      */
     write_preserve_type write_preserve_{};
 
+    /**
+     * @brief key range of write preserve
+     * @details The storage in this is preserved only in the range, so short
+     * transactions which access the storage out of the range don't conflict
+     * with this long transaction. This long transaction can't write out of
+     * the range. If a storage has some ranges, the range covering them is
+     * used. If a storage is also in @a write_preserve_, the whole storage is
+     * preserved.
+     */
+    write_preserve_range_type write_preserve_range_{};
+
     /**
      * @brief read area
      * @details The storage list information that the area which may be read by
@@ -146,6 +195,24 @@ private:
      * negative list is invalid(i.e. not used).
      */
     read_area read_area_{};
+
+    /**
+     * @brief shared snapshot
+     * @details If you use transaction_type::READ_ONLY, you can use this
+     * member. The transaction reads the snapshot opened by open_snapshot
+     * instead of deciding its own snapshot, and shares the resolved versions
+     * with the other transactions attached to the same snapshot.
+     */
+    SnapshotHandle snapshot_{};
+
+    /**
+     * @brief label of the logical transaction
+     * @details The retries of the same logical transaction should have the
+     * same label. The engine tracks the aborts per label and may promote
+     * the repeatedly aborting SHORT to LONG. See
+     * recommend_transaction_options.
+     */
+    std::string label_{};
 };
 
 inline constexpr std::string_view
@@ -187,6 +254,19 @@ to_string(std::vector<Storage> const& write_preserve) noexcept {
     return buf;
 }
 
+inline std::string
+to_string(transaction_options::write_preserve_range_type const& wpr) noexcept {
+    std::string buf{};
+    bool at_least_once{false};
+    for (auto&& elem : wpr) {
+        buf += std::to_string(std::get<0>(elem));
+        buf += "[" + std::get<1>(elem) + ", " + std::get<2>(elem) + "] ";
+        at_least_once = true;
+    }
+    if (at_least_once) { buf.pop_back(); }
+    return buf;
+}
+
 inline std::string
 to_string(const transaction_options::read_area& ra) noexcept {
     std::string buf{};
@@ -216,7 +296,11 @@ inline std::ostream& operator<<(std::ostream& out,
     return out << "Token: " << to.get_token()
                << ", transaction_type: " << to.get_transaction_type()
                << ", write_preserve: " << to_string(to.get_write_preserve())
-               << ", read_area: " << to_string(to.get_read_area());
+               << ", write_preserve_range: "
+               << to_string(to.get_write_preserve_range())
+               << ", read_area: " << to_string(to.get_read_area())
+               << ", snapshot: " << to.get_snapshot()
+               << ", label: " << to.get_label();
 }
 
 } // namespace shirakami
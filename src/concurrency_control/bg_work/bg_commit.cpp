@@ -1,7 +1,11 @@
 
-#include "clock.h"
+#include <chrono>
+#include <vector>
 
 #include "concurrency_control/bg_work/include/bg_commit.h"
+#include "concurrency_control/include/epoch.h"
+#include "concurrency_control/include/ongoing_tx.h"
+#include "concurrency_control/include/promotion.h"
 #include "concurrency_control/include/session.h"
 #include "concurrency_control/interface/long_tx/include/long_tx.h"
 
@@ -12,13 +16,23 @@
 namespace shirakami::bg_work {
 
 void bg_commit::clear_tx() {
-    std::lock_guard<std::shared_mutex> lk_{mtx_cont_wait_tx()};
-    cont_wait_tx().clear();
+    {
+        std::lock_guard<std::shared_mutex> lk_{mtx_cont_wait_tx()};
+        cont_wait_tx().clear();
+    }
+    std::lock_guard<std::mutex> lk{mtx_resolver_};
+    work_queue_.clear();
+    dependants_.clear();
+    wait_any_.clear();
+    waiters_.clear();
 }
 
 void bg_commit::init(std::size_t waiting_resolver_threads_num) {
     // send signal
-    worker_thread_end(false);
+    {
+        std::lock_guard<std::mutex> lk{mtx_resolver_};
+        worker_thread_end(false);
+    }
 
     // set waiting resolver threads
     waiting_resolver_threads(waiting_resolver_threads_num);
@@ -34,7 +48,11 @@ void bg_commit::init(std::size_t waiting_resolver_threads_num) {
 
 void bg_commit::fin() {
     // send signal
-    worker_thread_end(true);
+    {
+        std::lock_guard<std::mutex> lk{mtx_resolver_};
+        worker_thread_end(true);
+    }
+    cv_resolver_.notify_all();
 
     // wait thread end
     for (auto&& elem : workers()) { elem.join(); }
@@ -65,75 +83,181 @@ void bg_commit::register_tx(Token token) {
             // already exist
             LOG_FIRST_N(ERROR, 1)
                     << log_location_prefix << "library programming error";
+            return;
         }
     }
+
+    /**
+     * The events before this registration are unknown, so a worker tries it
+     * at once and then it waits for the events.
+     */
+    {
+        std::lock_guard<std::mutex> lk{mtx_resolver_};
+        waiters_[ti->get_long_tx_id()] = waiter_info{};
+        schedule(ti->get_long_tx_id());
+    }
+    cv_resolver_.notify_one();
 }
 
-void bg_commit::worker() {
-    while (!worker_thread_end()) {
-        sleepUs(epoch::get_global_epoch_time_us());
+void bg_commit::schedule(std::size_t const ltx_id) {
+    // @pre lock mtx_resolver_
+    auto itr = waiters_.find(ltx_id);
+    if (itr == waiters_.end()) { return; }
+    auto& info = itr->second;
+    switch (info.state_) {
+        case waiter_state::WAITING:
+            unlink(ltx_id, info);
+            info.state_ = waiter_state::QUEUED;
+            work_queue_.emplace_back(ltx_id);
+            break;
+        case waiter_state::RUNNING:
+            info.state_ = waiter_state::RUNNING_NOTIFIED;
+            break;
+        default:
+            // already scheduled
+            break;
+    }
+}
 
-        std::set<std::size_t> checked_ids = {};
-        Token token{};
-        std::size_t tx_id{};
-        session* ti{};
-    // find process tx
-    REFIND : // NOLINT
-        {
-            std::shared_lock<std::shared_mutex> lk1{mtx_cont_wait_tx()};
-            // if cont empty then clear used_ids
-            if (cont_wait_tx().empty()) {
-                {
-                    std::unique_lock<std::mutex> lk2{mtx_used_ids()};
-                    if (!used_ids().empty()) { used_ids().clear(); }
+void bg_commit::unlink(std::size_t const ltx_id, waiter_info& info) {
+    // @pre lock mtx_resolver_
+    for (auto dep : info.deps_) {
+        auto d_itr = dependants_.find(dep);
+        if (d_itr == dependants_.end()) { continue; }
+        d_itr->second.erase(ltx_id);
+        if (d_itr->second.empty()) { dependants_.erase(d_itr); }
+    }
+    info.deps_.clear();
+    if (info.wait_any_) {
+        wait_any_.erase(ltx_id);
+        info.wait_any_ = false;
+    }
+}
+
+void bg_commit::wait_for(session* const ti, std::size_t const ltx_id,
+                         std::size_t const events) {
+    auto wait_for = ti->extract_wait_for();
+
+    bool scheduled{false};
+    {
+        std::lock_guard<std::mutex> lk{mtx_resolver_};
+        auto itr = waiters_.find(ltx_id);
+        if (itr == waiters_.end()) {
+            LOG_FIRST_N(ERROR, 1)
+                    << log_location_prefix << "library programming error";
+            return;
+        }
+        auto& info = itr->second;
+        bool const notified{info.state_ == waiter_state::RUNNING_NOTIFIED};
+        info.state_ = waiter_state::WAITING;
+        if (notified || events != resolver_events_) {
+            // some events occurred while trying, retry
+            schedule(ltx_id);
+            scheduled = true;
+        } else {
+            // build waits-for edges for living higher priority ltx
+            for (auto dep : wait_for) {
+                if (dep < ltx_id && ongoing_tx::exist_id(dep)) {
+                    dependants_[dep].insert(ltx_id);
+                    info.deps_.insert(dep);
                 }
-                continue;
             }
-            auto itr = cont_wait_tx().begin();
-            for (; itr != cont_wait_tx().end(); ++itr) {
-                token = std::get<1>(*itr);
-                tx_id = std::get<0>(*itr);
-                ti = static_cast<session*>(token);
-
-                // check conflict between worker
-                {
-                    std::unique_lock<std::mutex> lk2{mtx_used_ids()};
-                    // find by the id
-                    auto find_itr = used_ids().find(tx_id);
-                    if (find_itr != used_ids().end()) {
-                        // found
-                        continue;
-                    } // not found, not currently used
-                    // check already checked
-                    auto checked_itr = checked_ids.find(tx_id);
-                    if (checked_itr != checked_ids.end()) {
-                        // found
-                        continue;
-                    } // not found, not currently used and not checked
-                    // check from long
-                    if (ti->get_tx_type() !=
-                                transaction_options::transaction_type::LONG ||
-                        !ti->get_requested_commit()) {
-                        // not long or not requested commit.
-                        LOG_FIRST_N(ERROR, 1)
-                                << log_location_prefix
-                                << "library programming error. "
-                                << ti->get_tx_type() << ", " << std::boolalpha
-                                << ti->get_requested_commit()
-                                << ", tx_id:" << tx_id;
-                        return;
-                    }
-                    used_ids().insert(tx_id);
-                    checked_ids.insert(tx_id);
-                    break;
-                }
+            if (info.deps_.empty()) {
+                /**
+                 * It waits for something not in wait for information, e.g.
+                 * read of higher priority ltx.
+                 */
+                wait_any_.insert(ltx_id);
+                info.wait_any_ = true;
+            }
+        }
+    }
+    if (scheduled) { cv_resolver_.notify_one(); }
+}
+
+void bg_commit::notify_finish(std::size_t const ltx_id) {
+    {
+        std::lock_guard<std::mutex> lk{mtx_resolver_};
+        ++resolver_events_;
+        if (waiters_.empty()) { return; }
+
+        // dependants of the ltx
+        auto d_itr = dependants_.find(ltx_id);
+        if (d_itr != dependants_.end()) {
+            auto targets = d_itr->second;
+            for (auto id : targets) { schedule(id); }
+        }
+
+        // lower priority ltx which may wait for it
+        std::vector<std::size_t> targets(wait_any_.upper_bound(ltx_id),
+                                         wait_any_.end());
+        for (auto id : targets) { schedule(id); }
+    }
+    cv_resolver_.notify_all();
+}
+
+void bg_commit::notify_read_area_update(std::size_t const ltx_id) {
+    {
+        std::lock_guard<std::mutex> lk{mtx_resolver_};
+        ++resolver_events_;
+        if (wait_any_.empty()) { return; }
+        std::vector<std::size_t> targets(wait_any_.upper_bound(ltx_id),
+                                         wait_any_.end());
+        for (auto id : targets) { schedule(id); }
+    }
+    cv_resolver_.notify_all();
+}
+
+void bg_commit::worker() {
+    for (;;) {
+        std::size_t tx_id{};
+        std::size_t events{};
+        {
+            std::unique_lock<std::mutex> lk{mtx_resolver_};
+            if (!cv_resolver_.wait_for(
+                        lk,
+                        std::chrono::microseconds(
+                                epoch::get_global_epoch_time_us()),
+                        [] {
+                            return worker_thread_end() || !work_queue_.empty();
+                        })) {
+                /**
+                 * timeout. The waits not in wait for information may be
+                 * resolved by the events this doesn't know, e.g. epoch
+                 * progress, so retry them.
+                 */
+                std::vector<std::size_t> targets(wait_any_.begin(),
+                                                 wait_any_.end());
+                for (auto id : targets) { schedule(id); }
+                if (work_queue_.empty()) { continue; }
             }
-            if (itr == cont_wait_tx().end()) {
-                // reached last
-                checked_ids.clear();
-                continue;
+            if (worker_thread_end()) { break; }
+            tx_id = work_queue_.front();
+            work_queue_.pop_front();
+            waiters_[tx_id].state_ = waiter_state::RUNNING;
+            events = resolver_events_;
+        }
+
+        session* ti{};
+        {
+            std::shared_lock<std::shared_mutex> lk{mtx_cont_wait_tx()};
+            auto itr = cont_wait_tx().find(tx_id);
+            if (itr != cont_wait_tx().end()) {
+                ti = static_cast<session*>(itr->second);
             }
         }
+        // check from long
+        if (ti == nullptr ||
+            ti->get_tx_type() != transaction_options::transaction_type::LONG ||
+            !ti->get_requested_commit()) {
+            // not long or not requested commit.
+            LOG_FIRST_N(ERROR, 1) << log_location_prefix
+                                  << "library programming error. tx_id:"
+                                  << tx_id;
+            std::lock_guard<std::mutex> lk{mtx_resolver_};
+            waiters_.erase(tx_id);
+            continue;
+        }
 
         // process
         // try commit
@@ -145,30 +269,29 @@ void bg_commit::worker() {
              * than this transaction wait for the result of this
              * transaction.
              */
-            {
-                /**
-                 * concurrent thread へコミット処理を許容する。checked_ids によって
-                 * 自身は次の周回まで繰り返してトライすることは無い。
-                 */
-                std::unique_lock<std::mutex> lk2{mtx_used_ids()};
-                used_ids().erase(tx_id);
-            }
-            goto REFIND; // NOLINT
-        }                // termination was successed
-        ti->set_result_requested_commit(rc);
+            wait_for(ti, tx_id, events);
+            continue;
+        } // termination was successed
 
-        // erase the tx from cont
+        // erase the tx from resolver and cont before publishing the result
+        {
+            std::lock_guard<std::mutex> lk{mtx_resolver_};
+            auto itr = waiters_.find(tx_id);
+            if (itr != waiters_.end()) {
+                unlink(tx_id, itr->second);
+                waiters_.erase(itr);
+            }
+        }
         {
             std::lock_guard<std::shared_mutex> lk1{mtx_cont_wait_tx()};
             cont_wait_tx().erase(tx_id);
         }
-        /**
-         * used_ids から tx_id 要素を削除して並行スレッドへコミット処理を許容しては
-         * ならない。なぜならコミット処理が同一TXに対して重複してエラーになる。待ち
-         * リストが空になったら安全に used_ids をクリアする。
-         */
-
-        goto REFIND; // NOLINT
+        // the result of the waited tx is fixed here, not at commit()
+        if (promotion::is_enabled() && !ti->get_tx_label().empty()) {
+            promotion::record_long_result(ti->get_tx_label(),
+                                          rc == Status::OK);
+        }
+        ti->set_result_requested_commit(rc);
     }
 
     // normal termination, update joined_waiting_resolver
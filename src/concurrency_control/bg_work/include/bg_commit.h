@@ -1,6 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <map>
 #include <mutex>
 #include <set>
@@ -12,6 +15,12 @@
 
 #include "shirakami/tx_state_notification.h"
 
+namespace shirakami {
+
+class session;
+
+} // namespace shirakami
+
 namespace shirakami::bg_work {
 
 class bg_commit {
@@ -22,17 +31,50 @@ public:
      */
     using cont_type = std::map<std::size_t, Token>;
     using worker_cont_type = std::vector<std::thread>;
-    using used_ids_type = std::set<std::size_t>;
+
+    /**
+     * @brief The state of a waiting transaction in the resolver.
+     */
+    enum class waiter_state : std::uint8_t {
+        /**
+         * @brief It waits for some events.
+         */
+        WAITING,
+        /**
+         * @brief It is in the work queue.
+         */
+        QUEUED,
+        /**
+         * @brief A worker tries to commit it now.
+         */
+        RUNNING,
+        /**
+         * @brief A worker tries to commit it now and some events occurred
+         * during that, so it must be retried.
+         */
+        RUNNING_NOTIFIED,
+    };
+
+    /**
+     * @brief The information of a waiting transaction in the resolver.
+     */
+    struct waiter_info {
+        waiter_state state_{waiter_state::WAITING};
+        /**
+         * @brief ltx ids which this waits for to finish.
+         */
+        std::set<std::size_t> deps_{};
+        /**
+         * @brief whether this waits for any higher priority ltx.
+         */
+        bool wait_any_{false};
+    };
 
     // start: getter
     static worker_cont_type& workers() { return worker_threads_; }
 
     [[nodiscard]] static bool worker_thread_end() { return worker_thread_end_; }
 
-    static used_ids_type& used_ids() { return used_ids_; }
-
-    static std::mutex& mtx_used_ids() { return mtx_used_ids_; }
-
     static std::shared_mutex& mtx_cont_wait_tx() { return mtx_cont_wait_tx_; }
 
     static cont_type& cont_wait_tx() { return cont_wait_tx_; }
@@ -73,6 +115,22 @@ public:
 
     static void register_tx(Token token);
 
+    /**
+     * @brief notify that the ltx finished (committed or aborted).
+     * @details The transactions waiting for the ltx are scheduled. This must
+     * be called after the ltx was removed from ongoing_tx and read_plan.
+     * @param[in] ltx_id
+     */
+    static void notify_finish(std::size_t ltx_id);
+
+    /**
+     * @brief notify that the read area of the ltx was fixed by its commit
+     * request.
+     * @details The transactions which may wait for its read are scheduled.
+     * @param[in] ltx_id
+     */
+    static void notify_read_area_update(std::size_t ltx_id);
+
     static void worker();
 
 private:
@@ -94,17 +152,6 @@ private:
      */
     static inline worker_cont_type worker_threads_; // NOLINT
 
-    /**
-     * @brief This is a list what transaction do it be processed now by @a
-     * worker_threads_ to prevent conflict.
-     */
-    static inline used_ids_type used_ids_; // NOLINT
-
-    /**
-     * @brief mutex for @a used_ids_
-     */
-    static inline std::mutex mtx_used_ids_; // NOLINT
-
     /**
      * @brief Flag used for signal to start or stop worker thread.
      *
@@ -121,6 +168,66 @@ private:
      * @brief container of long transactions waiting to commit.
      */
     static inline cont_type cont_wait_tx_; // NOLINT
+
+    /**
+     * @brief mutex for the resolver state, from @a resolver_events_ to @a
+     * waiters_.
+     */
+    static inline std::mutex mtx_resolver_; // NOLINT
+
+    /**
+     * @brief condition variable to wake up worker threads.
+     */
+    static inline std::condition_variable cv_resolver_; // NOLINT
+
+    /**
+     * @brief The number of events which may resolve waiting. It is used to
+     * detect the events which occurred while a worker tried commit.
+     */
+    static inline std::size_t resolver_events_{}; // NOLINT
+
+    /**
+     * @brief The ltx ids to be tried commit by workers.
+     */
+    static inline std::deque<std::size_t> work_queue_; // NOLINT
+
+    /**
+     * @brief The waits-for graph. key is ltx id and value is ltx ids waiting
+     * for the key to finish.
+     */
+    static inline std::map<std::size_t, std::set<std::size_t>> // NOLINT
+            dependants_;
+
+    /**
+     * @brief ltx ids waiting for some higher priority ltx which is not known
+     * from its wait for information, e.g. read wait.
+     */
+    static inline std::set<std::size_t> wait_any_; // NOLINT
+
+    /**
+     * @brief The information of waiting transactions. key is ltx id.
+     */
+    static inline std::map<std::size_t, waiter_info> waiters_; // NOLINT
+
+    /**
+     * @brief schedule the waiting transaction.
+     * @pre lock @a mtx_resolver_
+     */
+    static void schedule(std::size_t ltx_id);
+
+    /**
+     * @brief remove the transaction from the waits-for graph.
+     * @pre lock @a mtx_resolver_
+     */
+    static void unlink(std::size_t ltx_id, waiter_info& info);
+
+    /**
+     * @brief register what the transaction waits for after a failed try.
+     * @param[in] ti the waiting transaction.
+     * @param[in] ltx_id the id of @a ti.
+     * @param[in] events @a resolver_events_ before the try.
+     */
+    static void wait_for(session* ti, std::size_t ltx_id, std::size_t events);
 };
 
 } // namespace shirakami::bg_work
@@ -1,7 +1,9 @@
 
 #include <algorithm>
-
-#include "clock.h"
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <vector>
 
 #include "concurrency_control/include/epoch.h"
 #include "concurrency_control/include/epoch_internal.h"
@@ -24,6 +26,67 @@
 
 namespace shirakami::epoch {
 
+/**
+ * @brief mutex for @a expedite_target.
+ */
+static std::mutex expedite_mtx; // NOLINT
+
+/**
+ * @brief condition variable to wake up the epoch thread.
+ */
+static std::condition_variable expedite_cv; // NOLINT
+
+/**
+ * @brief The largest epoch requested by request_expedite_epoch. It is reset
+ * when the epoch thread reaches it.
+ */
+static epoch_t expedite_target{0}; // NOLINT
+
+/**
+ * @brief mutex for @a rtx_barrier_waiters.
+ */
+static std::mutex rtx_barrier_mtx; // NOLINT
+
+/**
+ * @brief waiters of rtx barrier. key is the anchor epoch.
+ */
+static std::multimap<epoch_t, rtx_barrier_waiter_type> // NOLINT
+        rtx_barrier_waiters;
+
+void add_rtx_barrier_waiter(epoch_t const anchor,
+                            rtx_barrier_waiter_type waiter) {
+    {
+        std::lock_guard<std::mutex> lk{rtx_barrier_mtx};
+        if (get_cc_safe_ss_epoch() < anchor && !get_epoch_thread_end()) {
+            rtx_barrier_waiters.emplace(anchor, std::move(waiter));
+            return;
+        }
+    }
+    waiter(get_cc_safe_ss_epoch() >= anchor);
+}
+
+/**
+ * @brief call the waiters of rtx barrier released by cc_safe_ss_epoch.
+ * @param[in] all If true, call all the waiters, e.g. at shutdown.
+ */
+static void release_rtx_barrier_waiters(bool const all) {
+    std::vector<std::pair<epoch_t, rtx_barrier_waiter_type>> released{};
+    {
+        std::lock_guard<std::mutex> lk{rtx_barrier_mtx};
+        if (rtx_barrier_waiters.empty()) { return; }
+        auto end = all ? rtx_barrier_waiters.end()
+                       : rtx_barrier_waiters.upper_bound(get_cc_safe_ss_epoch());
+        for (auto itr = rtx_barrier_waiters.begin(); itr != end; ++itr) {
+            released.emplace_back(itr->first, std::move(itr->second));
+        }
+        rtx_barrier_waiters.erase(rtx_barrier_waiters.begin(), end);
+    }
+    // call outside of the lock, the waiter may acquire other barrier
+    for (auto&& elem : released) {
+        elem.second(get_cc_safe_ss_epoch() >= elem.first);
+    }
+}
+
 static inline void refresh_short_expose_ongoing_status(const epoch_t ce) {
     epoch_t min_short_expose_ongoing_target_epoch{session::lock_and_epoch_t::UINT63_MASK};
     for (auto&& itr : session_table::get_session_table()) {
@@ -76,22 +139,21 @@ static inline void compute_and_set_cc_safe_ss_epoch() {
     {
         std::shared_lock<std::shared_mutex> lk_ongo{ongoing_tx::get_mtx()};
 
-        // ongoing_tx::tx_info may contain RTX, so remove RTX here
-        ongoing_tx::tx_info_type ongoing_ltx{};
-        ongoing_ltx.reserve(ongoing_tx::get_tx_info().size());
-        std::copy_if(ongoing_tx::get_tx_info().begin(), ongoing_tx::get_tx_info().end(),
-                     std::back_inserter(ongoing_ltx),
-                     [](const auto& elem){
-                             return std::get<ongoing_tx::index_session>(elem)->get_tx_type() !=
-                                     transaction_options::transaction_type::READ_ONLY;});
+        // ongoing_tx::tx_info may contain RTX, so skip RTX here
+        auto is_ltx = [](const auto& elem) {
+            return std::get<ongoing_tx::index_session>(elem)->get_tx_type() !=
+                   transaction_options::transaction_type::READ_ONLY;
+        };
+        auto& ongoing = ongoing_tx::get_tx_info();
 
-        if (ongoing_ltx.empty()) {
+        if (std::none_of(ongoing.begin(), ongoing.end(), is_ltx)) {
             // set cc safe ss epoch
             set_cc_safe_ss_epoch(get_global_epoch() + 1);
             return;
         }
         // exist ltx
-        for (auto& elem : ongoing_ltx) {
+        for (auto& elem : ongoing) {
+            if (!is_ltx(elem)) { continue; }
             auto* ti = std::get<ongoing_tx::index_session>(elem);
             // initialize result_epoch
             if (result_epoch == 0) { result_epoch = ti->get_valid_epoch(); }
@@ -140,9 +202,32 @@ static inline void compute_and_set_cc_safe_ss_epoch() {
     set_cc_safe_ss_epoch(result_epoch);
 }
 
+void request_expedite_epoch(epoch_t const target) {
+    {
+        std::lock_guard<std::mutex> lk{expedite_mtx};
+        if (target <= get_global_epoch() || target <= expedite_target) {
+            // already reached or requested
+            return;
+        }
+        expedite_target = target;
+    }
+    expedite_cv.notify_one();
+}
+
 void epoch_thread_work() {
+    auto next_time = std::chrono::steady_clock::now() +
+                     std::chrono::microseconds(get_global_epoch_time_us());
     while (!get_epoch_thread_end()) {
-        sleepUs(epoch::get_global_epoch_time_us());
+        {
+            // sleep until the epoch time or expedite request
+            std::unique_lock<std::mutex> lk{expedite_mtx};
+            expedite_cv.wait_until(lk, next_time, [] {
+                return get_epoch_thread_end() ||
+                       expedite_target > get_global_epoch();
+            });
+        }
+        next_time = std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(get_global_epoch_time_us());
         {
             // coordination with ltx
             auto wp_mutex = std::unique_lock<std::mutex>(wp::get_wp_mutex());
@@ -150,7 +235,12 @@ void epoch_thread_work() {
             auto ptp{epoch::get_perm_to_proc()};
             // -1: ptp invalid
             // 0: no work to proceed
-            if (ptp == 0) { continue; } // no work
+            if (ptp == 0) {
+                // no work, the requests wait for resume
+                std::lock_guard<std::mutex> lk_ex{expedite_mtx};
+                expedite_target = 0;
+                continue;
+            }
             if (ptp < -1) {
                 LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path.";
                 return;
@@ -164,6 +254,10 @@ void epoch_thread_work() {
             // change also datastore's epoch
             switch_epoch(shirakami::datastore::get_datastore(), new_epoch);
 #endif
+            {
+                std::lock_guard<std::mutex> lk_ex{expedite_mtx};
+                if (expedite_target <= new_epoch) { expedite_target = 0; }
+            }
             // compute for debug tools
             if (ptp > 0) {
                 // ptp allow epoch inclement
@@ -171,12 +265,24 @@ void epoch_thread_work() {
             }
             // dtor : release wp_mutex
         }
+        /**
+         * cc_safe_ss_epoch was updated. The waiters are called after
+         * releasing wp_mutex because they may begin a transaction.
+         */
+        release_rtx_barrier_waiters(false);
     }
 }
 
 void fin() {
-    set_epoch_thread_end(true);
+    {
+        std::lock_guard<std::mutex> lk{expedite_mtx};
+        set_epoch_thread_end(true);
+        expedite_target = 0;
+    }
+    expedite_cv.notify_one();
     join_epoch_thread();
+    // the barriers will not be released any more
+    release_rtx_barrier_waiters(true);
 }
 
 void init([[maybe_unused]] std::size_t const epoch_time) {
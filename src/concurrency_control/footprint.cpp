@@ -0,0 +1,79 @@
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+#include <unordered_map>
+
+#include "concurrency_control/include/footprint.h"
+
+namespace shirakami::footprint {
+
+/**
+ * @brief the write ranges per storage. Both ends are inclusive.
+ */
+using footprint_type =
+        std::map<Storage, std::tuple<std::string, std::string>>;
+
+/**
+ * @brief mutex for @a footprint_table.
+ */
+static std::shared_mutex mtx_footprint_table; // NOLINT
+
+static std::unordered_map<std::string, footprint_type> // NOLINT
+        footprint_table;
+
+static void merge_range(footprint_type& fp, Storage const st,
+                        std::string_view const left,
+                        std::string_view const right) {
+    auto itr = fp.find(st);
+    if (itr == fp.end()) {
+        fp.emplace(st, std::make_tuple(std::string(left), std::string(right)));
+        return;
+    }
+    if (left < std::get<0>(itr->second)) { std::get<0>(itr->second) = left; }
+    if (std::get<1>(itr->second) < right) { std::get<1>(itr->second) = right; }
+}
+
+void record(std::string const& label,
+            local_write_set::storage_map const& smap) {
+    if (smap.empty()) { return; }
+    std::lock_guard<std::shared_mutex> lk{mtx_footprint_table};
+    auto& fp = footprint_table[label];
+    for (auto&& elem : smap) {
+        merge_range(fp, elem.first, std::get<0>(elem.second),
+                    std::get<1>(elem.second));
+    }
+}
+
+void add_write_key(std::string const& label, Storage const st,
+                   std::string_view const key) {
+    std::lock_guard<std::shared_mutex> lk{mtx_footprint_table};
+    merge_range(footprint_table[label], st, key, key);
+}
+
+bool find(std::string const& label,
+          transaction_options::write_preserve_range_type& out) {
+    std::shared_lock<std::shared_mutex> lk{mtx_footprint_table};
+    auto itr = footprint_table.find(label);
+    if (itr == footprint_table.end()) { return false; }
+    out.clear();
+    out.reserve(itr->second.size());
+    for (auto&& elem : itr->second) {
+        out.emplace_back(elem.first, std::get<0>(elem.second),
+                         std::get<1>(elem.second));
+    }
+    return true;
+}
+
+bool clear(std::string const& label) {
+    std::lock_guard<std::shared_mutex> lk{mtx_footprint_table};
+    return footprint_table.erase(label) != 0;
+}
+
+void fin() {
+    std::lock_guard<std::shared_mutex> lk{mtx_footprint_table};
+    footprint_table.clear();
+}
+
+} // namespace shirakami::footprint
@@ -8,6 +8,7 @@
 #include "concurrency_control/include/epoch.h"
 #include "concurrency_control/include/garbage.h"
 #include "concurrency_control/include/session.h"
+#include "concurrency_control/include/shared_snapshot.h"
 #include "concurrency_control/include/wp.h"
 
 #include "database/include/logging.h"
@@ -126,13 +127,20 @@ void work_manager() {
             VLOG(log_debug) << log_location_prefix << "min_begin_epoch back from " << old << " to " << min_begin_epoch << " (ignored)";
         }
         // computing about ltx
+        auto min_batch_epoch = epoch::get_cc_safe_ss_epoch();
         if (valid_epoch != 0) {
             // exist some ltx
-            auto csse = epoch::get_cc_safe_ss_epoch();
-            set_min_batch_epoch(std::min(csse, valid_epoch));
-        } else {
-            set_min_batch_epoch(epoch::get_cc_safe_ss_epoch());
+            min_batch_epoch = std::min(min_batch_epoch, valid_epoch);
+        }
+        /**
+         * computing about shared snapshot. It must be after reading
+         * cc_safe_ss_epoch. A snapshot opened after that has the epoch not
+         * less than it.
+         */
+        if (auto sse = shared_snapshot::get_min_epoch(); sse != 0) {
+            min_batch_epoch = std::min(min_batch_epoch, sse);
         }
+        set_min_batch_epoch(min_batch_epoch);
 #ifdef PWAL
         switch_available_boundary_version(shirakami::datastore::get_datastore(), std::min(get_min_begin_epoch(), get_min_batch_epoch()));
 #endif
@@ -457,6 +465,48 @@ static void release_key_memory() {
     }
 }
 
+void retire_tree(std::string name) {
+    get_container_tree().emplace_back(std::move(name),
+                                      epoch::get_global_epoch());
+}
+
+void release_tree(std::string_view const name) {
+    std::vector<std::tuple<std::string, Record**, std::size_t>> scan_res;
+    yakushima::scan(name, "", yakushima::scan_endpoint::INF, "",
+                    yakushima::scan_endpoint::INF, scan_res);
+    for (auto&& elem : scan_res) {
+        delete reinterpret_cast<Record*>(std::get<1>(elem)); // NOLINT
+    }
+    auto rc = yakushima::delete_storage(name);
+    if (rc != yakushima::status::OK) {
+        LOG_FIRST_N(ERROR, 1)
+                << log_location_prefix << rc << ", unreachable path";
+    }
+}
+
+static void force_release_tree_memory() {
+    auto& cont = garbage::get_container_tree();
+    for (auto&& elem : cont) { release_tree(elem.first); }
+    cont.clear();
+}
+
+static void release_tree_memory() {
+    auto& cont = garbage::get_container_tree();
+    auto me = std::min(garbage::get_min_begin_epoch(),
+                       garbage::get_min_batch_epoch());
+    std::size_t erase_count{0};
+    for (auto&& elem : cont) {
+        // same as release_key_memory
+        if (elem.second >= me) { break; }
+        release_tree(elem.first);
+        ++erase_count;
+        if (get_flag_cleaner_end()) { break; }
+    }
+    if (erase_count > 0) {
+        cont.erase(cont.begin(), cont.begin() + erase_count); // NOLINT
+    }
+}
+
 void set_dirty(Storage st) {
     if (!envflag_reduce_gc_) { return; }
 
@@ -512,6 +562,7 @@ void work_cleaner() {
             unhooking_keys_and_pruning_versions(stats_info);
             if (get_flag_cleaner_end()) { break; }
             release_key_memory();
+            release_tree_memory();
         }
 
         // output detail info
@@ -523,7 +574,9 @@ void work_cleaner() {
         // sleep
         sleepUs(epoch::get_global_epoch_time_us());
     }
+    std::unique_lock lk{get_mtx_cleaner()};
     force_release_key_memory();
+    force_release_tree_memory();
 }
 
 } // namespace shirakami::garbage
@@ -1,6 +1,10 @@
 
 #pragma once
 
+#include <functional>
+
+#include "concurrency_control/include/epoch.h"
+
 namespace shirakami::epoch {
 
 [[maybe_unused]] extern void epoch_thread_work();
@@ -11,4 +15,26 @@ namespace shirakami::epoch {
 
 [[maybe_unused]] extern void invoke_epoch_thread();
 
+/**
+ * @brief request the epoch thread to advance the global epoch to @a target
+ * without waiting for the epoch time.
+ * @details The requests which come before the epoch thread wakes up are
+ * served by one epoch advance.
+ * @param[in] target The epoch to be reached.
+ */
+[[maybe_unused]] extern void request_expedite_epoch(epoch_t target);
+
+/**
+ * @brief The waiter of rtx barrier. The argument is true if the barrier was
+ * released, false if the epoch thread ended before that.
+ */
+using rtx_barrier_waiter_type = std::function<void(bool)>;
+
+/**
+ * @brief register the waiter called when cc_safe_ss_epoch reaches @a anchor.
+ * @details If it was already reached, the waiter is called by this thread.
+ */
+[[maybe_unused]] extern void add_rtx_barrier_waiter(
+        epoch_t anchor, rtx_barrier_waiter_type waiter);
+
 } // namespace shirakami::epoch
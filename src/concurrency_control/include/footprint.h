@@ -0,0 +1,51 @@
+/**
+ * @file concurrency_control/include/footprint.h
+ * @brief write footprint of long transactions recorded per label.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "concurrency_control/include/local_set.h"
+
+#include "shirakami/scheme.h"
+#include "shirakami/transaction_options.h"
+
+namespace shirakami::footprint {
+
+/**
+ * @brief merge the write ranges of the ltx into the footprint of the label.
+ * @param[in] label the label of the tx.
+ * @param[in] smap the storage map of the write set of the tx.
+ */
+void record(std::string const& label,
+            local_write_set::storage_map const& smap);
+
+/**
+ * @brief add the key which the ltx tried to write without write preserve.
+ */
+void add_write_key(std::string const& label, Storage st, std::string_view key);
+
+/**
+ * @brief find the footprint of the label.
+ * @return true found.
+ * @return false not found.
+ */
+[[nodiscard]] bool find(std::string const& label,
+                        transaction_options::write_preserve_range_type& out);
+
+/**
+ * @brief clear the footprint of the label.
+ * @return true cleared.
+ * @return false not found.
+ */
+bool clear(std::string const& label);
+
+/**
+ * @brief clear all the footprints at shutdown.
+ */
+void fin();
+
+} // namespace shirakami::footprint
@@ -2,6 +2,8 @@
 
 #include <atomic>
 #include <mutex>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <tuple>
 #include <unordered_set>
@@ -104,6 +106,47 @@ struct alignas(CACHE_LINE_SIZE) storage_stats {
         std::pair<Record*, epoch::epoch_t>>
         container_rec_{};
 
+/**
+ * @brief container of index trees which were detached from storages by
+ * truncate_storage or async delete_storage.
+ * First of elements is the internal name of the tree. Second of elements is
+ * global epoch of detaching.
+ */
+[[maybe_unused]] inline std::vector< // NOLINT
+        std::pair<std::string, epoch::epoch_t>>
+        container_tree_{};
+
+/**
+ * @brief counter to make the internal name of the detached tree unique.
+ */
+[[maybe_unused]] inline std::atomic<std::uint64_t> detached_tree_ctr_{0};
+
+/**
+ * @brief make the internal name for the tree detached from the storage.
+ * @details It is longer than the name of any storage, so it is not listed as
+ * a storage.
+ */
+[[maybe_unused]] static std::string
+get_new_detached_tree_name(std::string_view const storage_view) {
+    std::string name{storage_view};
+    auto ctr = detached_tree_ctr_.fetch_add(1, std::memory_order_acq_rel);
+    name.append(reinterpret_cast<char*>(&ctr), sizeof(ctr)); // NOLINT
+    return name;
+}
+
+/**
+ * @brief hand the detached tree to the cleaner. The records in the tree are
+ * released by the cleaner after all the transactions which may see them
+ * finished.
+ * @pre It holds the lock of cleaner.
+ */
+[[maybe_unused]] extern void retire_tree(std::string name);
+
+/**
+ * @brief release the records in the detached tree and the tree at once.
+ */
+[[maybe_unused]] extern void release_tree(std::string_view name);
+
 // setter
 [[maybe_unused]] static void set_flag_cleaner_end(bool const tf) {
     flag_cleaner_end.store(tf, std::memory_order_release);
@@ -123,6 +166,11 @@ get_container_rec() {
     return container_rec_;
 }
 
+[[maybe_unused]] static std::vector<std::pair<std::string, epoch::epoch_t>>&
+get_container_tree() {
+    return container_tree_;
+}
+
 [[maybe_unused]] static bool get_flag_cleaner_end() {
     return flag_cleaner_end.load(std::memory_order_acquire);
 }
@@ -4,11 +4,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <shared_mutex>
 #include <sstream>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "cpu.h"
 #include "record.h"
@@ -20,6 +24,7 @@
 
 #include "index/yakushima/include/tool.h"
 
+#include "shirakami/api_storage.h"
 #include "shirakami/scheme.h"
 #include "shirakami/storage_options.h"
 
@@ -68,6 +73,25 @@ static_assert(std::is_nothrow_move_constructible_v<read_set_obj>);
 
 class write_set_obj { // NOLINT
 public:
+    /**
+     * @brief kind of read-modify-write which is resolved at commit phase.
+     */
+    enum class rmw_kind : std::uint8_t {
+        /**
+         * @brief The value of this write is fixed.
+         */
+        NONE,
+        /**
+         * @brief The value is written if the record has the expected value.
+         */
+        UPDATE_IF,
+        /**
+         * @brief The value is computed by the merge operator from the value of
+         * the record.
+         */
+        MERGE,
+    };
+
     // for update / upsert / insert
     write_set_obj(Storage const storage, OP_TYPE const op,
                   Record* const rec_ptr, std::string_view const val,
@@ -123,19 +147,103 @@ public:
 
     std::string_view get_value_view() { return val_; }
 
+    /**
+     * @brief take the value buffer out of this object.
+     * @details It is for handing the payload over to the log record at the
+     * end of commit without copying. After this, the value of this object is
+     * empty, so it must be the last access to the value.
+     */
+    std::string release_value() { return std::exchange(val_, {}); }
+
     [[nodiscard]] bool get_inc_tombstone() const { return inc_tombstone_; }
 
     [[nodiscard]] const std::vector<blob_id_type>& get_lobs() const { return lobs_; }
 
-    void set_op(OP_TYPE op) { op_ = op; }
+    [[nodiscard]] rmw_kind get_rmw() const {
+        return rmw_ == nullptr ? rmw_kind::NONE : rmw_->kind_;
+    }
+
+    /**
+     * @brief make this write conditional on the value of the record.
+     * @param[in] expected the value which the record must have at commit.
+     */
+    void set_update_if(std::string_view const expected) {
+        rmw_ = std::make_unique<rmw_state>();
+        rmw_->kind_ = rmw_kind::UPDATE_IF;
+        rmw_->expected_ = expected;
+    }
+
+    /**
+     * @brief make this write a merge into the value of the record.
+     * @param[in] op the merge operator.
+     * @param[in] operand the operand of the merge.
+     */
+    void set_merge(merge_operator_type op, std::string_view const operand) {
+        rmw_ = std::make_unique<rmw_state>();
+        rmw_->kind_ = rmw_kind::MERGE;
+        rmw_->merge_op_ = std::move(op);
+        rmw_->operands_.emplace_back(operand);
+    }
+
+    /**
+     * @brief merge the operand into this write.
+     * @details If the value of this write is fixed, it is merged now.
+     * Otherwise, the operand is applied after the former ones at commit.
+     */
+    void merge(merge_operator_type const& op, std::string_view const operand) {
+        if (get_rmw() == rmw_kind::MERGE) {
+            rmw_->operands_.emplace_back(operand);
+            return;
+        }
+        std::string out{};
+        op(val_, operand, out);
+        val_ = std::move(out);
+    }
+
+    /**
+     * @brief fix the value of this write by the value of the record.
+     * @param[in] current the value of the record.
+     * @return true the value is fixed.
+     * @return false the record doesn't have the expected value of update_if.
+     */
+    bool resolve_rmw(std::string_view const current) {
+        if (get_rmw() == rmw_kind::UPDATE_IF) {
+            if (current != rmw_->expected_) { return false; }
+        } else if (get_rmw() == rmw_kind::MERGE) {
+            std::string base{current};
+            std::string out{};
+            for (auto&& operand : rmw_->operands_) {
+                out.clear();
+                rmw_->merge_op_(base, operand, out);
+                base.swap(out);
+            }
+            val_ = std::move(base);
+        }
+        clear_rmw();
+        return true;
+    }
+
+    /**
+     * @brief set operation type
+     * @details Pending read-modify-write is discarded since the operation
+     * overwrites it.
+     */
+    void set_op(OP_TYPE op) {
+        op_ = op;
+        clear_rmw();
+    }
 
     void set_rec_ptr(Record* rec_ptr) { rec_ptr_ = rec_ptr; }
 
     /**
      * @brief set value
-     * @details It is for twice update in the same transaction.
+     * @details It is for twice update in the same transaction. Pending
+     * read-modify-write is discarded since the blind write overwrites it.
      */
-    void set_val(std::string_view const val) { val_ = val; }
+    void set_val(std::string_view const val) {
+        val_ = val;
+        clear_rmw();
+    }
 
     void set_inc_tombstone(bool tf) { inc_tombstone_ = tf; }
 
@@ -170,6 +278,32 @@ private:
      * @brief large object info
      */
     std::vector<blob_id_type> lobs_;
+    /**
+     * @brief state of pending read-modify-write.
+     */
+    struct rmw_state {
+        rmw_kind kind_{rmw_kind::NONE};
+        /**
+         * @brief expected value for update_if.
+         */
+        std::string expected_{};
+        /**
+         * @brief merge operator for merge.
+         */
+        merge_operator_type merge_op_{};
+        /**
+         * @brief operands for merge in the order of the operation.
+         */
+        std::vector<std::string> operands_{};
+    };
+    /**
+     * @brief pending read-modify-write.
+     * @details It is allocated only by merge and update_if, so the other
+     * writes pay only a pointer for it.
+     */
+    std::unique_ptr<rmw_state> rmw_{};
+
+    void clear_rmw() { rmw_.reset(); }
 };
 
 class local_write_set {
@@ -197,6 +331,14 @@ public:
         storage_map_.clear();
     }
 
+    /**
+     * @brief check whether no write is registered.
+     */
+    [[nodiscard]] bool empty() {
+        std::shared_lock<std::shared_mutex> lk{get_mtx()};
+        return cont_for_occ_.empty() && cont_for_bt_.empty();
+    }
+
     Status erase(write_set_obj* wso);
 
     [[nodiscard]] bool get_for_batch() const {
@@ -292,7 +434,13 @@ private:
  */
 class local_read_set_for_ltx {
 public:
-    using cont_type = std::set<Record*>;
+    /**
+     * @brief container of read records.
+     * @details Records are appended in read order, so the same record may
+     * appear multiple times until sort_and_unique() is called. This keeps
+     * push cheap (no tree node allocation) on the read hot path of ltx.
+     */
+    using cont_type = std::vector<Record*>;
 
     std::shared_mutex& get_mtx_set() { return mtx_set_; }
 
@@ -305,7 +453,18 @@ public:
     void push(Record* rec) {
         // take write lock
         std::lock_guard<std::shared_mutex> lk{get_mtx_set()};
-        set_.insert(rec);
+        set_.emplace_back(rec);
+    }
+
+    /**
+     * @brief remove duplicate records.
+     * @pre caller must not hold the lock of this set.
+     */
+    void sort_and_unique() {
+        // take write lock
+        std::lock_guard<std::shared_mutex> lk{get_mtx_set()};
+        std::sort(set_.begin(), set_.end());
+        set_.erase(std::unique(set_.begin(), set_.end()), set_.end());
     }
 
     // getter
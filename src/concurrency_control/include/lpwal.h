@@ -96,6 +96,12 @@ public:
                std::string_view key, std::string_view val, const std::vector<blob_id_type>& lobs) // NOLINT
         : operation_(operation), wv_(wv), st_(st), key_(key), val_(val), lobs_(lobs) {}
 
+    // it takes over the key and value buffers.
+    log_record(log_operation operation, write_version_type wv, Storage st,
+               std::string&& key, std::string&& val, const std::vector<blob_id_type>& lobs) // NOLINT
+        : operation_(operation), wv_(wv), st_(st), key_(std::move(key)),
+          val_(std::move(val)), lobs_(lobs) {}
+
     [[nodiscard]] log_operation get_operation() const { return operation_; }
 
     [[nodiscard]] std::string_view get_key() const { return key_; }
@@ -188,11 +194,19 @@ public:
     void push_log(log_record const& log) {
         if (logs_.empty()) {
             set_min_log_epoch(log.get_wv().get_major_write_version());
-            begin_session();
+            if (!begun_session_) { begin_session(); }
         }
         logs_.emplace_back(log);
     }
 
+    void push_log(log_record&& log) {
+        if (logs_.empty()) {
+            set_min_log_epoch(log.get_wv().get_major_write_version());
+            if (!begun_session_) { begin_session(); }
+        }
+        logs_.emplace_back(std::move(log));
+    }
+
     void init() {
         worker_number_ = 0;
         min_log_epoch_ = 0;
@@ -243,7 +257,8 @@ private:
      */
     logs_type logs_{};
 
-    // invariant: logs_.empty() == !begun_session_
+    // invariant: logs_.empty() == !begun_session_ except in
+    // add_entry_keep_session and the end of the session by its caller
     bool begun_session_{false};
     epoch::epoch_t durable_epoch_{};
 
@@ -259,6 +274,14 @@ private:
  */
 [[maybe_unused]] extern void flush_log(Token token);
 
+/**
+ * @brief hand the log records to the log channel without ending the session.
+ * @details It is for a large write which must be durable atomically. The
+ * next push_log continues the session and the caller ends it.
+ * @pre take mtx of logs
+ */
+extern void add_entry_keep_session(handler& handle);
+
 /**
  * @brief Set the log dir object
  *
@@ -56,10 +56,25 @@ public:
      */
     static tx_info_type& get_tx_info() { return tx_info_; }
 
+    /**
+     * @brief register the tx keeping the order by id.
+     */
     static void push(tx_info_elem_type ti);
 
+    /**
+     * @brief register the tx keeping the order by id.
+     * @details Ids are almost always given in ascending order, so it is
+     * usually an amortized O(1) append. An out of order id is inserted by
+     * vector::insert, which is O(n).
+     * @pre lock for tx_info_
+     */
     static void push_bringing_lock(tx_info_elem_type ti);
 
+    /**
+     * @brief unregister the tx.
+     * @details The entry is found by binary search in O(log n), but
+     * vector::erase shifts the following entries, so this is O(n) as a whole.
+     */
     static void remove_id(std::size_t id);
 
     /**
@@ -86,6 +101,8 @@ private:
     static inline std::shared_mutex mtx_; // NOLINT
     /**
      * @brief register info of running long tx's epoch and id.
+     * @details This is ordered by id, so the first element is the highest
+     * priority and it can be searched by binary search.
      */
     static inline tx_info_type tx_info_; // NOLINT
     /**
@@ -96,6 +113,13 @@ private:
      * @brief waiting bypass to root (aggressive optimization).
      */
     static inline bool optflag_waiting_bypass_to_root_; // NOLINT
+
+    /**
+     * @brief find the element of @a id by binary search.
+     * @pre lock for tx_info_
+     * @return the iterator of the element, or end of tx_info_ if not found.
+     */
+    static tx_info_type::iterator find_id(std::size_t id);
 };
 
 } // namespace shirakami
@@ -0,0 +1,82 @@
+/**
+ * @file concurrency_control/include/promotion.h
+ * @brief promotion of repeatedly aborting short transactions to long.
+ */
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "shirakami/api_promotion.h"
+#include "shirakami/result_info.h"
+#include "shirakami/scheme.h"
+#include "shirakami/transaction_options.h"
+
+namespace shirakami::promotion {
+
+/**
+ * @brief whether the aborts per label are tracked.
+ */
+[[nodiscard]] bool is_enabled();
+
+/**
+ * @brief record the result of commit of the short tx.
+ * @param[in] label the label of the tx.
+ * @param[in] committed whether the tx committed.
+ * @param[in] rc the reason of the abort.
+ * @param[in] write_storages the storages which the tx wrote. It is sorted
+ * and has no duplicates.
+ */
+void record_short_result(std::string const& label, bool committed,
+                         reason_code rc,
+                         std::vector<Storage> const& write_storages);
+
+/**
+ * @brief record the result of commit of the long tx.
+ * @details The promoted label is demoted to short if the long tx with it
+ * aborted as many times in a row as the promotion threshold, or committed
+ * SHIRAKAMI_OCC_PROMOTION_DECAY times after the promotion.
+ */
+void record_long_result(std::string const& label, bool committed);
+
+/**
+ * @brief record that tx_begin began the short tx with the label as long tx.
+ */
+void record_auto_promoted_begin(std::string const& label);
+
+/**
+ * @brief add the storage which the promoted tx tried to write without write
+ * preserve. The next promoted tx preserves it.
+ */
+void add_write_storage(std::string const& label, Storage st);
+
+/**
+ * @brief find the promotion for the label.
+ * @param[in] label the label of the tx.
+ * @param[out] wp the inferred write preserve.
+ * @return true the tx with the label should be long.
+ * @return false else.
+ */
+[[nodiscard]] bool find_promotion(std::string const& label,
+                                  transaction_options::write_preserve_type& wp);
+
+/**
+ * @brief get the statistics about the label.
+ * @return true found.
+ * @return false not found.
+ */
+[[nodiscard]] bool get_stats(std::string const& label, promotion_stats& out);
+
+/**
+ * @brief print the statistics of all the labels.
+ */
+void print_diagnostics(std::ostream& out);
+
+/**
+ * @brief clear the history at shutdown.
+ */
+void fin();
+
+} // namespace shirakami::promotion
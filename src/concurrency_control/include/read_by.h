@@ -11,9 +11,14 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <vector>
 
 #include "concurrency_control/include/epoch.h"
@@ -22,20 +27,38 @@
 
 namespace shirakami {
 
+/**
+ * @brief point read information by long transactions attached to each record.
+ * @details It is a fixed capacity array ordered by ltx id and protected by a
+ * sequence lock, so is_exist doesn't take any lock and doesn't write shared
+ * memory while the array holds all entries. If the entries don't fit into the
+ * array after pruning, the array keeps the entries of the highest priority and
+ * the rest are kept exactly in @a overflow_. is_exist takes @a mtx_overflow_
+ * only in that case. Entries are never merged, so is_exist doesn't return
+ * true for a conflict which doesn't exist.
+ */
 class point_read_by_long {
 public:
+    /**
+     * @brief first is epoch. the second is long_tx_id.
+     */
     using body_elem_type = std::pair<epoch::epoch_t, std::size_t>;
-    using body_type = std::vector<body_elem_type>;
+
+    static constexpr std::size_t capacity = 4;
+
+    using body_type = std::array<body_elem_type, capacity>;
 
     /**
-     * @brief get equal epoch's read_by
+     * @brief whether some ltx with higher priority than the ltx on @a token
+     * read this at its epoch or later.
      * @param[in] token
-     * @return body_elem_type
      */
     bool is_exist(Token token);
 
     /**
      * @brief push element and gc.
+     * @details The elements whose epoch is less than cc safe snapshot epoch
+     * are removed at the same time.
      * @param[in] elem
      */
     void push(body_elem_type elem);
@@ -46,13 +69,47 @@ public:
     void print();
 
 private:
-    std::shared_mutex mtx_;
+    /**
+     * @brief copy the consistent elements.
+     * @param[out] out The elements ordered by ltx id. The unused elements have
+     * 0 epoch.
+     * @return true if some elements are in @a overflow_.
+     */
+    bool read_body(body_type& out);
+
+    /**
+     * @brief mutex for @a overflow_. The writer holds it during the whole
+     * push, so a reader holding it sees the array and @a overflow_
+     * consistently.
+     */
+    std::mutex mtx_overflow_{};
+
+    /**
+     * @brief elements which are lower priority than all elements in the
+     * array. They are ordered by ltx id.
+     */
+    std::vector<body_elem_type> overflow_{};
+
+    /**
+     * @brief whether @a overflow_ is not empty. It is written in the writer
+     * side of the sequence lock.
+     */
+    std::atomic<bool> overflowed_{false};
 
     /**
-     * @brief body
-     * @details std::pair.first is epoch. the second is long_tx_id.
+     * @brief version of sequence lock. It is odd while writing.
      */
-    body_type body_;
+    std::atomic<std::uint64_t> version_{0};
+
+    /**
+     * @brief epoch of each element. 0 means unused.
+     */
+    std::array<std::atomic<epoch::epoch_t>, capacity> epoch_{};
+
+    /**
+     * @brief ltx id of each element.
+     */
+    std::array<std::atomic<std::size_t>, capacity> ltx_id_{};
 };
 
 class range_read_by_long {
@@ -73,17 +130,50 @@ public:
                        std::string, scan_endpoint>;
     using body_type = std::vector<body_elem_type>;
 
+    /**
+     * @brief ranges read by long txs at one epoch.
+     * @details @a ranges_ is sorted by the left endpoint. Each element of
+     * @a max_right_pos_ is the position of the range which has the maximum
+     * right endpoint in the prefix of @a ranges_ until the same position, so
+     * the lookup can stop when no range in the prefix reaches the key.
+     */
+    struct partition {
+        body_type ranges_{};
+        std::vector<std::size_t> max_right_pos_{};
+    };
+
+    /**
+     * @brief key is epoch.
+     */
+    using partition_map_type = std::map<epoch::epoch_t, partition>;
+
+    /**
+     * @brief whether some ltx with higher priority than @a ltx_id read the
+     * range including @a key at epoch @a ep.
+     * @details It takes O(log n + k) where n is the number of the ranges at
+     * @a ep and k is the number of the ranges checked after the binary search.
+     */
     bool is_exist(epoch::epoch_t ep, std::size_t ltx_id, std::string_view key);
 
     /**
      * @brief push element and gc.
+     * @details The ranges whose epoch is less than cc safe snapshot epoch are
+     * removed by the partition.
      * @param[in] elem
      */
     void push(body_elem_type const& elem);
 
 private:
-    std::mutex mtx_;
-    body_type body_;
+    static bool left_endpoint_less(body_elem_type const& a,
+                                   body_elem_type const& b);
+
+    static bool right_endpoint_less(body_elem_type const& a,
+                                    body_elem_type const& b);
+
+    static bool includes(body_elem_type const& elem, std::string_view key);
+
+    std::shared_mutex mtx_;
+    partition_map_type body_;
 };
 
 class point_read_by_short {
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <map>
+#include <set>
 #include <shared_mutex>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include "shirakami/scheme.h"
@@ -28,7 +33,77 @@ public:
                                 std::string, scan_endpoint>>;
     using nlist_type = std::set<Storage>;
 
-    using cont_type = std::map<std::size_t, std::tuple<plist_type, nlist_type>>;
+    /**
+     * @brief read plan compiled for the checks by the other ltxs.
+     * @details The positive list is split to the storages which may be read
+     * as a whole and the key ranges of the submitted plan, both sorted by
+     * storage. The mask is a 64 bit filter over the hashed storage ids, so
+     * the check for the ltx which writes no storage of the positive list
+     * ends without looking the lists.
+     */
+    struct compiled_plan {
+        using range_type = std::tuple<Storage, std::string, scan_endpoint,
+                                      std::string, scan_endpoint>;
+
+        /**
+         * @brief filter of the storages in the positive list.
+         */
+        std::uint64_t pmask_{};
+
+        /**
+         * @brief sorted storages of the positive list read as a whole.
+         */
+        std::vector<Storage> pstorages_{};
+
+        /**
+         * @brief key ranges of the positive list sorted by storage.
+         */
+        std::vector<range_type> pranges_{};
+
+        /**
+         * @brief sorted storages of the negative list.
+         */
+        std::vector<Storage> nstorages_{};
+    };
+
+    /**
+     * @details key is ltx id, value is the compiled form of its positive list
+     * and negative list. The lists themselves are not kept since only the
+     * compiled form is read.
+     */
+    using cont_type = std::map<std::size_t, compiled_plan>;
+
+    /**
+     * @brief the bit for @a st in the storage filter.
+     */
+    static std::uint64_t storage_bit(Storage const st) {
+        // fibonacci hashing to 6 bits
+        return std::uint64_t{1}
+               << ((st * 0x9e3779b97f4a7c15ULL) >> 58U); // NOLINT
+    }
+
+    /**
+     * @brief compile the positive list and the negative list.
+     */
+    static compiled_plan compile(plist_type const& pl, nlist_type const& nl) {
+        compiled_plan ret{};
+        // plist and nlist are ordered by storage, so the vectors are sorted.
+        for (auto&& elem : pl) {
+            ret.pmask_ |= storage_bit(std::get<0>(elem));
+            if (std::get<1>(elem)) {
+                ret.pranges_.emplace_back(std::get<0>(elem), std::get<2>(elem),
+                                          std::get<3>(elem), std::get<4>(elem),
+                                          std::get<5>(elem));
+            } else {
+                ret.pstorages_.emplace_back(std::get<0>(elem));
+            }
+        }
+        ret.pstorages_.erase(
+                std::unique(ret.pstorages_.begin(), ret.pstorages_.end()),
+                ret.pstorages_.end());
+        ret.nstorages_.assign(nl.begin(), nl.end());
+        return ret;
+    }
 
     static void clear() {
         std::lock_guard<std::shared_mutex> lk{get_mtx_cont()};
@@ -44,23 +119,25 @@ public:
         clear();
     }
 
-    // for tx begin
+    // for tx begin. compile the plan here, not at each check.
     static void add_elem(std::size_t const tx_id, read_area_type const& ra) {
-        std::lock_guard<std::shared_mutex> lk{get_mtx_cont()};
         plist_type tmp_plist;
         for (auto&& elem : ra.get_positive_list()) {
             tmp_plist.insert(std::make_tuple(elem, false, "",
                                              scan_endpoint::EXCLUSIVE, "",
                                              scan_endpoint::EXCLUSIVE));
         }
-        get_cont()[tx_id] = std::make_tuple(tmp_plist, ra.get_negative_list());
+        auto cp = compile(tmp_plist, ra.get_negative_list());
+        std::lock_guard<std::shared_mutex> lk{get_mtx_cont()};
+        get_cont()[tx_id] = std::move(cp);
     }
 
     // for commit submit
     static void add_elem(std::size_t const tx_id, plist_type const& pl,
                          nlist_type const& nl) {
+        auto cp = compile(pl, nl);
         std::lock_guard<std::shared_mutex> lk{get_mtx_cont()};
-        get_cont()[tx_id] = std::make_tuple(pl, nl);
+        get_cont()[tx_id] = std::move(cp);
     }
 
     static void remove_elem(std::size_t const tx_id) {
@@ -8,6 +8,8 @@
 #include <atomic>
 #include <mutex>
 #include <set>
+#include <string>
+#include <string_view>
 
 #include "cpu.h"
 #include "epoch.h"
@@ -35,6 +37,8 @@
 
 namespace shirakami {
 
+class shared_snapshot;
+
 class alignas(CACHE_LINE_SIZE) session {
 public:
     using range_read_by_short_set_type = std::set<range_read_by_short*>;
@@ -133,6 +137,7 @@ public:
         set_read_version_max_epoch(0);
         set_long_tx_id(0);
         set_valid_epoch(0);
+        set_shared_snapshot(nullptr);
         set_was_considering_forwarding_at_once(false);
         set_is_forwarding(false);
     }
@@ -278,6 +283,10 @@ public:
 
     std::mutex& get_mtx_result_info() { return mtx_result_info_; }
 
+    std::shared_mutex& get_mtx_read_set_for_stx() {
+        return mtx_read_set_for_stx_;
+    }
+
     // ========== end: strand
 
     std::shared_mutex& get_mtx_ltx_storage_read_set() {
@@ -309,6 +318,10 @@ public:
 
     read_set_for_stx_type& get_read_set_for_stx() { return read_set_for_stx_; }
 
+    [[nodiscard]] std::size_t get_ct_op_since_read_verify() const {
+        return ct_op_since_read_verify_;
+    }
+
     /**
      * @brief get the value of tx_began_.
      */
@@ -342,6 +355,12 @@ public:
         return valid_epoch_.load(std::memory_order_acquire);
     }
 
+    [[nodiscard]] shared_snapshot* get_shared_snapshot() const {
+        return shared_snapshot_;
+    }
+
+    [[nodiscard]] std::string const& get_tx_label() const { return tx_label_; }
+
     /**
      * @brief get the value of visible_.
      */
@@ -646,6 +665,10 @@ public:
         result_requested_commit_.store(st, std::memory_order_release);
     }
 
+    void set_ct_op_since_read_verify(std::size_t const num) {
+        ct_op_since_read_verify_ = num;
+    }
+
     void set_long_tx_id(std::size_t bid) { long_tx_id_ = bid; }
 
     void set_read_version_max_epoch(epoch::epoch_t const ep) {
@@ -672,6 +695,12 @@ public:
         valid_epoch_.store(ep, std::memory_order_release);
     }
 
+    void set_shared_snapshot(shared_snapshot* const ss) {
+        shared_snapshot_ = ss;
+    }
+
+    void set_tx_label(std::string_view const label) { tx_label_ = label; }
+
     void set_commit_callback(commit_callback_type cb) {
         commit_callback_ = std::move(cb);
     }
@@ -704,6 +733,50 @@ public:
      * @brief use da/term mutex if RTX
      */
     static inline bool optflag_rtx_da_term_mutex;
+
+    /**
+     * @brief the number of occ operations between early read verifications.
+     * @details 0 means early read verification is disabled, and occ verifies
+     * its read set only at commit phase.
+     */
+    static inline std::size_t optflag_occ_early_read_verify_interval{0};
+
+    /**
+     * @brief contention policy for write lock at occ commit phase.
+     */
+    static inline lock_contention_policy optflag_occ_lock_contention_policy{
+            lock_contention_policy::SPIN};
+
+    /**
+     * @brief the number of retries of bounded spin lock contention policy.
+     */
+    static inline std::size_t optflag_occ_lock_spin_bound{1000}; // NOLINT
+
+    /**
+     * @brief advance the epoch at once when LTX or RTX begins, so the tx
+     * starts without waiting for the epoch time.
+     */
+    static inline bool optflag_expedite_ltx_start{false};
+
+    /**
+     * @brief the number of consecutive aborts by read verify or wp verify
+     * after which short tx with the same label is promoted to long tx.
+     * @details 0 means the aborts are not tracked.
+     */
+    static inline std::size_t optflag_occ_promotion_threshold{0};
+
+    /**
+     * @brief begin the promoted tx as long tx automatically. If it is false,
+     * the promotion is only recommended by recommend_transaction_options.
+     */
+    static inline bool optflag_occ_auto_promotion{false};
+
+    /**
+     * @brief the number of commits of promoted long tx after which the label
+     * is demoted to short tx again.
+     * @details 0 means the promotion doesn't decay.
+     */
+    static inline std::size_t optflag_occ_promotion_decay{1000};
     // ========== end: config flags
 
 private:
@@ -791,6 +864,12 @@ private:
      */
     std::shared_mutex mtx_read_set_for_stx_;
 
+    /**
+     * @brief the number of occ operations since the last early read
+     * verification.
+     */
+    std::size_t ct_op_since_read_verify_{0};
+
     /**
      * @brief local write set.
      */
@@ -924,6 +1003,20 @@ private:
      */
     std::atomic<epoch::epoch_t> valid_epoch_{epoch::initial_epoch};
 
+    /**
+     * @brief the snapshot which this rtx is attached to.
+     * @details It is nullptr if this is not rtx or this rtx decided its own
+     * snapshot.
+     */
+    shared_snapshot* shared_snapshot_{};
+
+    /**
+     * @brief the label of the logical transaction given by tx_begin.
+     * @details It is used for tracking aborts per label. It is empty if the
+     * label was not given.
+     */
+    std::string tx_label_{};
+
     /**
      * @brief local wp set.
      * @details If this session processes long transaction in a long tx mode and
@@ -0,0 +1,175 @@
+/**
+ * @file concurrency_control/include/shared_snapshot.h
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "concurrency_control/include/epoch.h"
+#include "concurrency_control/include/record.h"
+#include "concurrency_control/include/version.h"
+
+#include "shirakami/scheme.h"
+
+namespace shirakami {
+
+/**
+ * @brief snapshot shared among read only transactions.
+ * @details It has the snapshot epoch and the cache of the versions resolved at
+ * the epoch. The versions whose epoch is less than the snapshot epoch are
+ * immutable after the global epoch reaches the snapshot epoch, so the
+ * resolved version can be reused by every attached transaction without
+ * traversing the version list again. The versions are protected from gc by
+ * get_min_epoch while the snapshot is open and by the valid epoch of the
+ * attached transactions after that.
+ */
+class shared_snapshot {
+public:
+    /**
+     * @brief the result of version resolution.
+     */
+    struct resolved_version {
+        /**
+         * @brief the version visible at the snapshot. It is nullptr if no
+         * version is visible.
+         */
+        version* ver_{};
+
+        /**
+         * @brief whether the record is absent at the snapshot.
+         */
+        bool absent_{};
+    };
+
+    /**
+     * @brief the number of cache slots. It must be a power of two.
+     * @details The cache stops growing when the probe sequence of a record is
+     * full, and the versions which were not cached are resolved by each
+     * transaction.
+     */
+    static constexpr std::size_t cache_size = 1U << 14U;
+
+    /**
+     * @brief the max number of slots probed for a record.
+     */
+    static constexpr std::size_t cache_max_probe = 8;
+
+    explicit shared_snapshot(epoch::epoch_t const ep) : epoch_(ep) {}
+
+    [[nodiscard]] epoch::epoch_t get_epoch() const { return epoch_; }
+
+    /**
+     * @brief resolve the version of @a rec_ptr visible at this snapshot.
+     * @details It uses the cache if the version was already resolved, else it
+     * traverses the version list and caches the result. The cache lookup
+     * takes no lock.
+     * @pre The global epoch is the snapshot epoch or later.
+     * @param[in] rec_ptr the target record.
+     * @param[out] out the result.
+     */
+    void resolve_version(Record* rec_ptr, resolved_version& out);
+
+    // ========== start: registry
+    /**
+     * @brief open a new snapshot.
+     * @pre This is called with wp mutex, so the epoch is not updated until
+     * the snapshot is registered and gc doesn't miss it.
+     * @param[in] ep the snapshot epoch.
+     * @param[out] out the opened snapshot.
+     */
+    static void open(epoch::epoch_t ep, shared_snapshot*& out);
+
+    /**
+     * @brief close the snapshot. It is freed when the attached transactions
+     * finish.
+     * @return Status::OK success.
+     * @return Status::WARN_INVALID_HANDLE @a ss is not opened.
+     */
+    static Status close(shared_snapshot* ss);
+
+    /**
+     * @brief attach a transaction to the snapshot.
+     * @return Status::OK success.
+     * @return Status::WARN_INVALID_HANDLE @a ss is not opened.
+     */
+    static Status attach(shared_snapshot* ss);
+
+    /**
+     * @brief detach a transaction from the snapshot.
+     */
+    static void detach(shared_snapshot* ss);
+
+    /**
+     * @brief get the minimum epoch of the opened snapshots.
+     * @return 0 if no snapshot is opened.
+     */
+    [[nodiscard]] static epoch::epoch_t get_min_epoch();
+
+    /**
+     * @brief free all the snapshots at shutdown.
+     */
+    static void fin();
+    // ========== end: registry
+
+private:
+    /**
+     * @brief slot of the open addressing cache.
+     * @details rec_ is claimed once by CAS and never cleared while the
+     * snapshot lives. resolved_ is 0 until the claiming thread publishes the
+     * result, and then it is the version pointer with the flag bits below.
+     */
+    struct cache_slot {
+        std::atomic<Record*> rec_{nullptr};
+        std::atomic<std::uintptr_t> resolved_{0};
+    };
+
+    /**
+     * @brief bit of resolved_ which shows the result was published.
+     */
+    static constexpr std::uintptr_t resolved_bit = 1U;
+
+    /**
+     * @brief bit of resolved_ which shows the record is absent.
+     */
+    static constexpr std::uintptr_t absent_bit = 2U;
+
+    static_assert(alignof(version) > (resolved_bit | absent_bit),
+                  "version pointer must leave the flag bits free");
+
+    static std::size_t get_home_slot(Record* const rec_ptr) {
+        // records are aligned, so drop the low bits before hashing
+        auto h = std::hash<Record*>{}(rec_ptr) >> 6U; // NOLINT
+        return h & (cache_size - 1);
+    }
+
+    /**
+     * @brief traverse the version list of @a rec_ptr at the snapshot epoch.
+     */
+    void traverse(Record* rec_ptr, resolved_version& out) const;
+
+    /**
+     * @brief the snapshot epoch.
+     */
+    epoch::epoch_t epoch_{};
+
+    /**
+     * @brief the number of the handle and the attached transactions. It is
+     * protected by the registry mutex.
+     */
+    std::size_t ref_count_{1};
+
+    /**
+     * @brief whether the handle was not closed. It is protected by the
+     * registry mutex.
+     */
+    bool opened_{true};
+
+    std::array<cache_slot, cache_size> cache_{};
+};
+
+} // namespace shirakami
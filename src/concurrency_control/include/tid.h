@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include <ostream>
@@ -15,6 +16,28 @@
 
 namespace shirakami {
 
+/**
+ * @brief policy for contended lock acquisition of tid_word.
+ */
+enum class lock_contention_policy : std::uint8_t {
+    /**
+     * @brief spin until it acquires the lock.
+     */
+    SPIN,
+    /**
+     * @brief spin with exponential backoff until it acquires the lock.
+     */
+    BACKOFF,
+    /**
+     * @brief spin at most the bound and give up.
+     */
+    BOUNDED_SPIN,
+    /**
+     * @brief give up at once if it is locked.
+     */
+    NO_WAIT,
+};
+
 class tid_word { // NOLINT
 public:
     union { // NOLINT
@@ -125,6 +148,18 @@ public:
 
     void lock(bool by_gc = false); // NOLINT
 
+    /**
+     * @brief try to lock according to the contention policy.
+     * @param[in] policy the contention policy.
+     * @param[in] spin_bound the number of retries for
+     * lock_contention_policy::BOUNDED_SPIN. It is ignored by other policies.
+     * @return true it acquired the lock.
+     * @return false it gave up acquiring the lock. It is possible only for
+     * lock_contention_policy::BOUNDED_SPIN and
+     * lock_contention_policy::NO_WAIT.
+     */
+    bool lock(lock_contention_policy policy, std::size_t spin_bound);
+
     /**
      * @pre This is called after lock() function.
      */
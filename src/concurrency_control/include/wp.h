@@ -22,6 +22,7 @@
 #include "concurrency_control/include/wp_meta.h"
 
 #include "shirakami/storage_options.h"
+#include "shirakami/transaction_options.h"
 
 #include "glog/logging.h"
 
@@ -37,7 +38,29 @@ public:
     page_set_meta() = default;
 
     explicit page_set_meta(storage_option options)
-        : storage_option_(std::move(options)) {} // NOLINT
+        : durable_(options.durable()),
+          storage_option_(std::move(options)) {} // NOLINT
+
+    /**
+     * @brief whether the writes to the storage are logged.
+     */
+    [[nodiscard]] bool get_durable() const { return durable_; }
+
+    /**
+     * @brief get the options of the storage.
+     * @details It is used for the non-durable storage whose options are not
+     * stored in the meta storage.
+     */
+    storage_option get_storage_option() {
+        std::shared_lock<std::shared_mutex> lk{mtx_storage_option_};
+        return storage_option_;
+    }
+
+    void set_storage_option(storage_option const& options) {
+        std::lock_guard<std::shared_mutex> lk{mtx_storage_option_};
+        storage_option_ = options;
+        storage_option_.durable(durable_);
+    }
 
     range_read_by_long* get_range_read_by_long_ptr() {
         return &range_read_by_long_;
@@ -52,6 +75,8 @@ public:
     garbage::storage_stats* get_storage_stats_ptr() { return &storage_stats_; }
 
 private:
+    bool durable_{true};
+    std::shared_mutex mtx_storage_option_{};
     storage_option storage_option_{};
     range_read_by_long range_read_by_long_{};
     range_read_by_short range_read_by_short_{};
@@ -106,6 +131,34 @@ void extract_higher_priori_ltx_info(session* ti, wp_meta* wp_meta_ptr,
 [[maybe_unused]] extern Status find_page_set_meta(Storage st,
                                                   page_set_meta*& ret);
 
+/**
+ * @brief whether the writes to the storage must be logged.
+ * @return true if the storage is durable or its metadata is not found.
+ */
+[[maybe_unused]] extern bool is_durable_storage(Storage st);
+
+/**
+ * @brief cache of the durability of storages for the write loop at commit.
+ * @details Write sets touch a few storages in most cases, so it keeps the
+ * result of the last lookup.
+ */
+class durability_cache {
+public:
+    bool is_durable(Storage const st) {
+        if (!valid_ || st != st_) {
+            st_ = st;
+            durable_ = is_durable_storage(st);
+            valid_ = true;
+        }
+        return durable_;
+    }
+
+private:
+    bool valid_{false};
+    Storage st_{};
+    bool durable_{true};
+};
+
 [[maybe_unused]] extern Status find_read_by(Storage st,
                                             range_read_by_long*& ret);
 
@@ -160,10 +213,18 @@ void extract_higher_priori_ltx_info(session* ti, wp_meta* wp_meta_ptr,
     page_set_meta_storage = storage;
 }
 
-[[maybe_unused]] extern Status write_preserve(Token token,
-                                              std::vector<Storage> storage,
-                                              std::size_t long_tx_id,
-                                              epoch::epoch_t valid_epoch);
+/**
+ * @brief register write preserve of the long tx.
+ * @param[in] token the session of the long tx.
+ * @param[in] storage the storages preserved entirely.
+ * @param[in] range the key ranges preserved.
+ * @param[in] long_tx_id the id of the long tx.
+ * @param[in] valid_epoch the epoch when the wp becomes valid.
+ */
+[[maybe_unused]] extern Status
+write_preserve(Token token, std::vector<Storage> storage,
+               transaction_options::write_preserve_range_type const& range,
+               std::size_t long_tx_id, epoch::epoch_t valid_epoch);
 
 } // namespace wp
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <cstddef>
 #include <map>
@@ -166,6 +167,50 @@ public:
                           std::string& out_right_key);
     // ==========
 
+    // about key range of write preserve
+    // ==========
+    /**
+     * @brief register the key range of the write preserve of the tx.
+     * @details The tx without the range preserves the whole storage. This is
+     * called before register_wp, so the others never see the wp without the
+     * range.
+     */
+    void push_wp_key_range(std::size_t txid, std::string_view left_key,
+                           std::string_view right_key);
+
+    /**
+     * @brief remove the key range of the tx if it exists.
+     */
+    void remove_wp_key_range(std::size_t txid);
+
+    /**
+     * @brief whether the write preserve of the tx covers the key.
+     * @return true the tx preserves the whole storage or the key is in its
+     * range.
+     */
+    bool is_key_preserved(std::size_t txid, std::string_view key);
+
+    /**
+     * @brief find minimum epoch of the write preserves which cover the key.
+     * @return 0 if no write preserve covers the key.
+     */
+    epoch::epoch_t find_min_ep_for_key(const wped_type& wped,
+                                       std::string_view key);
+
+    /**
+     * @brief find minimum epoch of the write preserves which intersect the
+     * range.
+     * @details The exclusive endpoint is treated as inclusive, it is
+     * conservative.
+     * @return 0 if no write preserve intersects the range.
+     */
+    epoch::epoch_t find_min_ep_for_range(const wped_type& wped,
+                                         std::string_view l_key,
+                                         scan_endpoint l_end,
+                                         std::string_view r_key,
+                                         scan_endpoint r_end);
+    // ==========
+
 private:
     /**
      * @brief write preserve infomation.
@@ -198,6 +243,22 @@ private:
 
     wp_write_range_type write_range_;
     // ==========
+
+    // about key range of write preserve
+    // ==========
+    /**
+     * @brief the number of elements of @a wp_key_range_. It is used for
+     * skipping the lock when no tx uses key range.
+     */
+    std::atomic<std::size_t> wp_key_range_num_{0};
+
+    std::shared_mutex mtx_wp_key_range_;
+
+    /**
+     * @brief declared key range of write preserve. Both ends are inclusive.
+     */
+    wp_write_range_type wp_key_range_;
+    // ==========
 };
 
 } // namespace shirakami::wp
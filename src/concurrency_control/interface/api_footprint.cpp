@@ -0,0 +1,48 @@
+
+#include <string>
+
+#include "concurrency_control/include/footprint.h"
+#include "database/include/logging.h"
+
+#include "shirakami/api_footprint.h"
+#include "shirakami/logging.h"
+
+#include "glog/logging.h"
+
+namespace shirakami {
+
+Status get_write_footprint(
+        std::string_view const label,
+        transaction_options::write_preserve_range_type& out) {
+    shirakami_log_entry << "get_write_footprint, label: " << label;
+    auto ret = footprint::find(std::string(label), out)
+                       ? Status::OK
+                       : Status::WARN_NOT_FOUND;
+    shirakami_log_exit << "get_write_footprint, Status: " << ret
+                       << ", footprint: " << to_string(out);
+    return ret;
+}
+
+Status apply_write_footprint(transaction_options& options) {
+    shirakami_log_entry << "apply_write_footprint, options: " << options;
+    Status ret{Status::WARN_NOT_FOUND};
+    transaction_options::write_preserve_range_type wpr{};
+    if (!options.get_label().empty() &&
+        footprint::find(options.get_label(), wpr)) {
+        options.set_write_preserve_range(wpr);
+        ret = Status::OK;
+    }
+    shirakami_log_exit << "apply_write_footprint, Status: " << ret
+                       << ", options: " << options;
+    return ret;
+}
+
+Status clear_write_footprint(std::string_view const label) {
+    shirakami_log_entry << "clear_write_footprint, label: " << label;
+    auto ret = footprint::clear(std::string(label)) ? Status::OK
+                                                    : Status::WARN_NOT_FOUND;
+    shirakami_log_exit << "clear_write_footprint, Status: " << ret;
+    return ret;
+}
+
+} // namespace shirakami
@@ -0,0 +1,41 @@
+
+#include "concurrency_control/include/promotion.h"
+#include "database/include/logging.h"
+
+#include "shirakami/api_promotion.h"
+#include "shirakami/logging.h"
+
+#include "glog/logging.h"
+
+namespace shirakami {
+
+Status recommend_transaction_options(transaction_options& options) {
+    shirakami_log_entry << "recommend_transaction_options, options: "
+                        << options;
+    Status ret{Status::WARN_NOT_FOUND};
+    transaction_options::write_preserve_type wp{};
+    if (options.get_transaction_type() ==
+                transaction_options::transaction_type::SHORT &&
+        !options.get_label().empty() &&
+        promotion::find_promotion(options.get_label(), wp)) {
+        options.set_transaction_type(
+                transaction_options::transaction_type::LONG);
+        options.set_write_preserve(wp);
+        ret = Status::OK;
+    }
+    shirakami_log_exit << "recommend_transaction_options, Status: " << ret
+                       << ", options: " << options;
+    return ret;
+}
+
+Status get_promotion_stats(std::string_view const label,
+                           promotion_stats& out) {
+    shirakami_log_entry << "get_promotion_stats, label: " << label;
+    auto ret = promotion::get_stats(std::string(label), out)
+                       ? Status::OK
+                       : Status::WARN_NOT_FOUND;
+    shirakami_log_exit << "get_promotion_stats, Status: " << ret;
+    return ret;
+}
+
+} // namespace shirakami
@@ -0,0 +1,249 @@
+
+#include <algorithm>
+#include <vector>
+
+#include "atomic_wrapper.h"
+#include "storage.h"
+
+#include "concurrency_control/include/epoch.h"
+#include "concurrency_control/include/garbage.h"
+#include "concurrency_control/include/session.h"
+#include "concurrency_control/include/wp.h"
+#include "concurrency_control/interface/include/helper.h"
+#include "database/include/logging.h"
+
+#include "index/yakushima/include/interface.h"
+
+#include "shirakami/interface.h"
+#include "shirakami/logging.h"
+
+#include "glog/logging.h"
+
+namespace shirakami {
+
+/**
+ * @brief The number of log records handed to the log channel at once.
+ * @details All the records are added to one session of the log channel, so
+ * the load becomes durable atomically while the memory for the local wal
+ * buffer is bounded regardless of the number of loaded records.
+ */
+[[maybe_unused]] static constexpr std::size_t bulk_load_log_batch_size{4096};
+
+static Status check_bulk_load_input(std::string_view const* const keys,
+                                    std::size_t const size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        auto rc = check_constraint_key_length(keys[i]); // NOLINT
+        if (rc != Status::OK) { return rc; }
+        // strictly ascending
+        if (i > 0 && !(keys[i - 1] < keys[i])) { // NOLINT
+            return Status::WARN_INVALID_ARGS;
+        }
+    }
+    return Status::OK;
+}
+
+static Status check_storage_empty(Storage const storage) {
+    std::vector<std::tuple<std::string, Record**, std::size_t>> scan_res;
+    auto rc = scan(storage, "", scan_endpoint::INF, "", scan_endpoint::INF, 1,
+                   scan_res, nullptr, false);
+    if (rc == Status::WARN_NOT_FOUND) { return Status::OK; }
+    if (rc == Status::OK) { return Status::WARN_ALREADY_EXISTS; }
+    return rc;
+}
+
+/**
+ * @brief make the records put so far tombstones which gc can unhook.
+ */
+static void cancel_bulk_load(Storage const storage,
+                             std::vector<Record*> const& recs) {
+    for (auto* rec_ptr : recs) {
+        tid_word tid{};
+        tid.set_absent(true);
+        tid.set_latest(false);
+        tid.set_lock(false);
+        rec_ptr->set_tid(tid); // and unlock
+    }
+    garbage::set_dirty(storage);
+}
+
+/**
+ * @brief compute timestamp in the same manner as short tx commit.
+ */
+static tid_word compute_bulk_load_tid(session* const ti,
+                                      epoch::epoch_t const ce) {
+    tid_word commit_tid{ti->get_mrc_tid()};
+    commit_tid.inc_tid();
+    tid_word tid_c{};
+    tid_c.set_epoch(ce);
+    commit_tid = std::max(commit_tid, tid_c);
+    commit_tid.set_lock(false);
+    commit_tid.set_absent(false);
+    commit_tid.set_latest(true);
+    commit_tid.set_by_short(true);
+    ti->set_mrc_tid(commit_tid);
+    return commit_tid;
+}
+
+#ifdef PWAL
+/**
+ * @brief log the records in the session of the log channel begun by the
+ * caller.
+ * @details The buffer is handed to the channel every
+ * bulk_load_log_batch_size records and the session is ended after all, so
+ * the durable epoch never covers a part of the load.
+ * @pre It holds the lock of the buffer, which blocks the flush by the daemon
+ * meanwhile, and the session is begun.
+ */
+static void log_bulk_load(lpwal::handler& handle, Storage const storage,
+                          tid_word const tid,
+                          std::string_view const* const keys,
+                          std::string_view const* const values,
+                          std::size_t const size) {
+    lpwal::write_version_type::minor_write_version_type minor_version = 1;
+    minor_version <<= 63; // NOLINT
+    minor_version |= tid.get_tid();
+    lpwal::write_version_type const wv{tid.get_epoch(), minor_version};
+
+    for (std::size_t begin = 0; begin < size;
+         begin += bulk_load_log_batch_size) {
+        std::size_t const end{std::min(begin + bulk_load_log_batch_size, size)};
+        for (std::size_t i = begin; i < end; ++i) {
+            handle.push_log(lpwal::log_record(log_operation::INSERT, wv,
+                                              storage, keys[i], // NOLINT
+                                              values[i], {}));  // NOLINT
+        }
+        lpwal::add_entry_keep_session(handle);
+    }
+    handle.end_session();
+}
+#endif
+
+/**
+ * @brief publish the records at one epoch and log them.
+ * @details The write preserve is checked again under the short expose lock
+ * since long tx may begin after the first check, and nothing is logged if it
+ * fails. The timestamp is computed once under the lock and used for both the
+ * records and the log. The session of the log channel is begun under the
+ * lock, and the records are logged after they are published and the lock is
+ * released, so the records are locked only while they are published.
+ * @return Status::OK success.
+ * @return Status::WARN_ILLEGAL_OPERATION some long tx preserves the storage.
+ * The records are canceled.
+ */
+static Status publish_bulk_load(session* const ti, Storage const storage,
+                                wp::wp_meta* const wm,
+                                std::string_view const* const keys,
+                                std::string_view const* const values,
+                                std::vector<Record*> const& recs) {
+#ifdef PWAL
+    bool const should_log{wp::is_durable_storage(storage)};
+    auto& handle = ti->get_lpwal_handle();
+    std::unique_lock<std::mutex> lk{handle.get_mtx_logs(), std::defer_lock};
+#else
+    (void)keys;
+    (void)values;
+#endif
+
+    // lock before get global epoch (for Record epoch)
+    ti->lock_short_expose_ongoing();
+    epoch::epoch_t ce{epoch::get_global_epoch()};
+
+    // long tx which will write the storage must not miss the records
+    if (wp::wp_meta::find_min_ep(wm->get_wped()) != 0) {
+        ti->unlock_short_expose_ongoing_and_refresh_epoch();
+        cancel_bulk_load(storage, recs);
+        return Status::WARN_ILLEGAL_OPERATION;
+    }
+
+    tid_word const commit_tid{compute_bulk_load_tid(ti, ce)};
+#ifdef PWAL
+    if (should_log) {
+        // the durable epoch doesn't pass the records until the session ends
+        lk.lock();
+        if (!handle.get_begun_session()) { handle.begin_session(); }
+    }
+#endif
+    for (auto* rec_ptr : recs) {
+        // set timestamp and unlock
+        rec_ptr->set_tid(commit_tid);
+    }
+
+    ti->unlock_short_expose_ongoing_and_refresh_epoch();
+
+#ifdef PWAL
+    if (should_log) {
+        log_bulk_load(handle, storage, commit_tid, keys, values, recs.size());
+    }
+#endif
+    return Status::OK;
+}
+
+static Status bulk_load_body(Token const token, Storage const storage,
+                             std::string_view const* const keys,
+                             std::string_view const* const values,
+                             std::size_t const size) {
+    auto* ti = static_cast<session*>(token);
+    if (ti->get_tx_began()) { return Status::WARN_ALREADY_BEGIN; }
+
+    auto rc = check_bulk_load_input(keys, size);
+    if (rc != Status::OK) { return rc; }
+
+    // check storage and wp data
+    wp::wp_meta* wm{};
+    if (wp::find_wp_meta(storage, wm) != Status::OK) {
+        return Status::WARN_STORAGE_NOT_FOUND;
+    }
+    // long tx which will write the storage must not miss the records
+    if (wp::wp_meta::find_min_ep(wm->get_wped()) != 0) {
+        return Status::WARN_ILLEGAL_OPERATION;
+    }
+
+    rc = check_storage_empty(storage);
+    if (rc != Status::OK) { return rc; }
+    if (size == 0) { return Status::OK; }
+
+    /**
+     * The records are put in inserting state with lock, so readers don't see
+     * them and concurrent inserters of the same key wait until the publish,
+     * which doesn't include logging.
+     */
+    std::vector<Record*> recs{};
+    recs.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        auto* rec_ptr = new Record(keys[i]); // NOLINT
+        rec_ptr->set_value(values[i]);       // NOLINT
+        rec_ptr->get_tidw_ref().set_lock(true);
+        yakushima::inserted_node_info ii{};
+        if (yakushima::status::OK != put<Record>(ti->get_yakushima_token(),
+                                                 storage, keys[i], // NOLINT
+                                                 rec_ptr, ii)) {
+            // the key was inserted concurrently
+            delete rec_ptr; // NOLINT
+            cancel_bulk_load(storage, recs);
+            return Status::WARN_ALREADY_EXISTS;
+        }
+        recs.emplace_back(rec_ptr);
+    }
+
+    return publish_bulk_load(ti, storage, wm, keys, values, recs);
+}
+
+Status bulk_load(Token const token, Storage const storage,
+                 std::string_view const* const keys,
+                 std::string_view const* const values, std::size_t const size) {
+    shirakami_log_entry << "bulk_load, token: " << token
+                        << ", storage: " << storage << ", size: " << size;
+    auto* ti = static_cast<session*>(token);
+    ti->process_before_start_step();
+    Status ret{};
+    { // for strand
+        std::shared_lock<std::shared_mutex> lock{ti->get_mtx_state_da_term()};
+
+        ret = bulk_load_body(token, storage, keys, values, size);
+    }
+    ti->process_before_finish_step();
+    shirakami_log_exit << "bulk_load, Status: " << ret;
+    return ret;
+}
+
+} // namespace shirakami
@@ -1,4 +1,7 @@
 
+#include <unordered_set>
+#include <vector>
+
 #include "atomic_wrapper.h"
 
 #include "storage.h"
@@ -8,6 +11,8 @@
 #include "concurrency_control/include/wp.h"
 #include "concurrency_control/interface/include/helper.h"
 #include "concurrency_control/interface/long_tx/include/long_tx.h"
+#include "concurrency_control/interface/scan/include/scan.h"
+#include "concurrency_control/interface/short_tx/include/short_tx.h"
 #include "database/include/logging.h"
 #include "index/yakushima/include/interface.h"
 
@@ -182,4 +187,141 @@ Status delete_record(Token token, Storage storage, const std::string_view key) {
     return ret;
 }
 
+static Status delete_range_body(Token token, Storage storage,
+                                std::string_view const l_key,
+                                scan_endpoint const l_end,
+                                std::string_view const r_key,
+                                scan_endpoint const r_end) {
+    // process about worker
+    auto* ti = static_cast<session*>(token);
+
+    // check whether it already began.
+    if (!ti->get_tx_began()) { return Status::WARN_NOT_BEGIN; }
+
+    // it uses occ phantom avoidance for the range
+    if (ti->get_tx_type() != transaction_options::transaction_type::SHORT) {
+        return Status::WARN_ILLEGAL_OPERATION;
+    }
+
+    // check for write
+    auto rc{check_before_write_ops(ti, storage, l_key, OP_TYPE::DELETE)};
+    if (rc != Status::OK) { return rc; }
+
+    // check wp for all the keys in the same manner as delete_record
+    wp::wp_meta* wm{};
+    if (wp::find_wp_meta(storage, wm) != Status::OK) {
+        return Status::WARN_STORAGE_NOT_FOUND;
+    }
+    auto wps = wm->get_wped();
+    auto find_min_ep{
+            wm->find_min_ep_for_range(wps, l_key, l_end, r_key, r_end)};
+    if (find_min_ep != 0) {
+        // exist valid wp
+        return Status::WARN_CONFLICT_ON_WRITE_PRESERVE;
+    }
+
+    rc = check_empty_scan_range(l_key, l_end, r_key, r_end);
+    if (rc != Status::OK) { return rc; }
+
+    // scan for index
+    std::vector<std::tuple<std::string, Record**, std::size_t>> scan_res;
+    constexpr std::size_t index_rec_ptr{1};
+    std::vector<std::pair<yakushima::node_version64_body,
+                          yakushima::node_version64*>>
+            nvec;
+    rc = scan(storage, l_key, l_end, r_key, r_end, 0, scan_res, &nvec, false);
+    if (rc == Status::WARN_STORAGE_NOT_FOUND || rc == Status::ERR_FATAL) {
+        return rc;
+    }
+
+    // phantom avoidance for the range
+    for (auto&& elem : nvec) {
+        auto rc_ns = ti->get_node_set().emplace_back(elem);
+        if (rc_ns == Status::ERR_CC) {
+            short_tx::abort(ti);
+            std::unique_lock<std::mutex> lk{ti->get_mtx_result_info()};
+            ti->get_result_info().set_storage_name(storage);
+            ti->set_result(reason_code::CC_OCC_PHANTOM_AVOIDANCE);
+            return Status::ERR_CC;
+        }
+    }
+    // read protection for low priori ltx
+    wp::page_set_meta* psm{};
+    if (wp::find_page_set_meta(storage, psm) != Status::OK) {
+        LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path";
+        return Status::ERR_FATAL;
+    }
+    ti->push_to_range_read_by_short_set(psm->get_range_read_by_short_ptr());
+    if (rc == Status::WARN_NOT_FOUND) { return rc; }
+
+    /**
+     * The write set of occ is searched linearly, so it looks up the records
+     * written so far once, not for each record in the range.
+     */
+    std::unordered_set<Record const*> written{};
+    {
+        std::shared_lock<std::shared_mutex> lk{ti->get_write_set().get_mtx()};
+        if (ti->get_write_set().get_for_batch()) {
+            for (auto&& elem : ti->get_write_set().get_ref_cont_for_bt()) {
+                written.insert(elem.first);
+            }
+        } else {
+            for (auto&& wso : ti->get_write_set().get_ref_cont_for_occ()) {
+                written.insert(wso.get_rec_ptr());
+            }
+        }
+    }
+
+    /**
+     * Each record is deleted by its own write set entry. The datastore has no
+     * log entry for a range, and readers don't check range tombstones, so a
+     * range tombstone can't be used here.
+     */
+    std::size_t num_deleted{0};
+    std::vector<Record*> own_written{};
+    for (auto&& elem : scan_res) {
+        Record* rec_ptr{*std::get<index_rec_ptr>(elem)};
+        if (written.find(rec_ptr) != written.end()) {
+            own_written.emplace_back(rec_ptr);
+            continue;
+        }
+        // check absent
+        tid_word ctid{loadAcquire(rec_ptr->get_tidw_ref().get_obj())};
+        if (ctid.get_absent()) { continue; }
+        // prepare write
+        ti->push_to_write_set({storage, OP_TYPE::DELETE, rec_ptr}); // NOLINT
+        ++num_deleted;
+    }
+    // delete own writes in the same manner as delete_record
+    for (auto* rec_ptr : own_written) {
+        write_set_obj* in_ws{ti->get_write_set().search(rec_ptr)}; // NOLINT
+        if (in_ws == nullptr) { continue; }
+        auto rs = process_after_write(ti, in_ws);
+        if (rs == Status::ERR_FATAL) { return rs; }
+        if (rs != Status::WARN_NOT_FOUND) { ++num_deleted; }
+    }
+
+    return num_deleted == 0 ? Status::WARN_NOT_FOUND : Status::OK;
+}
+
+Status delete_range(Token token, Storage storage, std::string_view const l_key,
+                    scan_endpoint const l_end, std::string_view const r_key,
+                    scan_endpoint const r_end) {
+    shirakami_log_entry << "delete_range, token: " << token
+                        << ", storage: " << storage << "," shirakami_binstring(l_key)
+                        << ", l_end: " << l_end << "," shirakami_binstring(r_key)
+                        << ", r_end: " << r_end;
+    auto* ti = static_cast<session*>(token);
+    ti->process_before_start_step();
+    Status ret{};
+    { // for strand
+        std::shared_lock<std::shared_mutex> lock{ti->get_mtx_state_da_term()};
+
+        ret = delete_range_body(token, storage, l_key, l_end, r_key, r_end);
+    }
+    ti->process_before_finish_step();
+    shirakami_log_exit << "delete_range, Status: " << ret;
+    return ret;
+}
+
 } // namespace shirakami
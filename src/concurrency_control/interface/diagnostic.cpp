@@ -1,4 +1,5 @@
 
+#include "concurrency_control/include/promotion.h"
 #include "concurrency_control/include/session.h"
 #include "database/include/logging.h"
 
@@ -17,6 +18,9 @@ void print_diagnostics(std::ostream& out) {
     // print for all session
     session_table::print_diagnostics(out);
 
+    // print for transaction labels tracked for promotion
+    promotion::print_diagnostics(out);
+
     out << log_location_prefix << "print diagnostics end" << std::endl; // NOLINT(*-avoid-endl)
     shirakami_log_exit << "print_diagnostics";
 }
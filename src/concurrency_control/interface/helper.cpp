@@ -9,11 +9,14 @@
 #include "include/helper.h"
 
 #include "concurrency_control/include/epoch_internal.h"
+#include "concurrency_control/include/footprint.h"
 #include "concurrency_control/include/helper.h"
+#include "concurrency_control/include/promotion.h"
 #include "concurrency_control/include/session.h"
 #include "concurrency_control/include/wp.h"
 #include "concurrency_control/interface/long_tx/include/long_tx.h"
 #include "concurrency_control/interface/read_only_tx/include/read_only_tx.h"
+#include "concurrency_control/interface/short_tx/include/short_tx.h"
 #include "database/include/logging.h"
 #include "index/yakushima/include/interface.h"
 
@@ -55,8 +58,16 @@ Status check_before_write_ops(session* const ti, Storage const st,
             // not in valid epoch.
             return Status::WARN_PREMATURE;
         }
-        if (!ti->check_exist_wp_set(st)) {
+        if (!ti->check_exist_wp_set(st) ||
+            !wm->is_key_preserved(ti->get_long_tx_id(), key)) {
             // can't write without wp.
+            if (!ti->get_tx_label().empty()) {
+                // the next tx with the label preserves it
+                footprint::add_write_key(ti->get_tx_label(), st, key);
+                if (promotion::is_enabled()) {
+                    promotion::add_write_storage(ti->get_tx_label(), st);
+                }
+            }
             return Status::WARN_WRITE_WITHOUT_WP;
         }
         if (op != OP_TYPE::UPSERT) {
@@ -78,7 +89,7 @@ Status check_before_write_ops(session* const ti, Storage const st,
                transaction_options::transaction_type::SHORT) {
         // check wp
         auto wps{wm->get_wped()};
-        auto find_min_ep{wp::wp_meta::find_min_ep(wps)};
+        auto find_min_ep{wm->find_min_ep_for_key(wps, key)};
         if (find_min_ep != 0 && op != OP_TYPE::UPSERT) {
             // exist valid wp
             //ti->get_result_info().set_reason_code(
@@ -86,6 +97,9 @@ Status check_before_write_ops(session* const ti, Storage const st,
             //ti->get_result_info().set_key_storage_name(key, st);
             return Status::WARN_CONFLICT_ON_WRITE_PRESERVE;
         }
+        // check reads so far
+        auto rs = short_tx::early_read_verify(ti);
+        if (rs != Status::OK) { return rs; }
     }
 
     return Status::OK;
@@ -140,6 +140,7 @@ void update_wp_at_commit(session* const ti) {
 }
 
 Status tx_begin(session* const ti, std::vector<Storage> write_preserve,
+                transaction_options::write_preserve_range_type const& wp_range,
                 transaction_options::read_area ra) { // NOLINT
     // get wp mutex, exclude long tx's coming and epoch update
     auto wp_mutex = std::unique_lock<std::mutex>(wp::get_wp_mutex());
@@ -151,9 +152,9 @@ Status tx_begin(session* const ti, std::vector<Storage> write_preserve,
     auto valid_epoch = epoch::get_global_epoch() + 1;
 
     // do write preserve
-    if (!write_preserve.empty()) {
-        auto rc{wp::write_preserve(ti, std::move(write_preserve), long_tx_id,
-                                   valid_epoch)};
+    if (!write_preserve.empty() || !wp_range.empty()) {
+        auto rc{wp::write_preserve(ti, std::move(write_preserve), wp_range,
+                                   long_tx_id, valid_epoch)};
         if (rc != Status::OK) { return rc; }
     }
 
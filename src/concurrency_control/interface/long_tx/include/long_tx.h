@@ -23,8 +23,10 @@ extern Status commit(session* ti);
 extern Status search_key(session* ti, Storage storage, std::string_view key,
                          std::string& value, bool read_value = true); // NOLINT
 
-extern Status tx_begin(session* ti, std::vector<Storage> write_preserve,
-                       transaction_options::read_area ra);
+extern Status
+tx_begin(session* ti, std::vector<Storage> write_preserve,
+         transaction_options::write_preserve_range_type const& wp_range,
+         transaction_options::read_area ra);
 
 extern void update_wp_at_commit(session* ti);
 
@@ -1,6 +1,10 @@
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string_view>
 #include <vector>
 
@@ -17,6 +21,7 @@
 #include "concurrency_control/interface/long_tx/include/long_tx.h"
 
 #include "database/include/logging.h"
+#include "database/include/thread_pool.h"
 
 #include "index/yakushima/include/interface.h"
 
@@ -90,248 +95,438 @@ static inline void compute_tid(session* ti, tid_word& ctid) {
     ctid.set_by_short(false);
 }
 
-static inline void expose_local_write(
-        session* ti, tid_word& committed_id,
-        std::map<Storage, std::tuple<std::string, std::string>>& write_range) {
-    tid_word ctid{};
-    compute_tid(ti, ctid);
-    committed_id = ctid;
-
-    //bool should_backward{ti->is_write_only_ltx_now()};
-    bool should_backward{!ti->get_is_forwarding()};
-
-    std::unordered_set<Storage> dirty{};
-    auto process = [ti, should_backward, &dirty](
-                           std::pair<Record* const, write_set_obj>& wse,
-                           tid_word ctid) {
-        auto* rec_ptr = std::get<0>(wse);
-        auto&& wso = std::get<1>(wse);
-        dirty.insert(wso.get_storage());
-        [[maybe_unused]] bool should_log{true};
-        // bw can backward including occ bw
-        switch (wso.get_op()) {
-            case OP_TYPE::UPSERT:
-            case OP_TYPE::INSERT: {
-                // about tombstone count
-                if (wso.get_inc_tombstone()) {
-                    auto* rec_ptr = wso.get_rec_ptr();
-                    rec_ptr->get_tidw_ref().lock();
-                    if (rec_ptr->get_shared_tombstone_count() == 0) {
-                        LOG_FIRST_N(ERROR, 1)
-                                << log_location_prefix << "unreachable path.";
-                    } else {
-                        --rec_ptr->get_shared_tombstone_count();
-                    }
-                    rec_ptr->get_tidw_ref().unlock();
-                }
-
-                tid_word tid{loadAcquire(rec_ptr->get_tidw_ref().get_obj())};
-                auto check_cd = [&tid]() {
-                    return tid.get_absent() && // inserting or deleted
-                           // DELETE'd Record (not-absent -> deleted) has non-zero epoch/tid
-                           tid.get_epoch() == 0 && tid.get_tid() == 0;
-                };
-                if (check_cd()) {
-                    // lock record
-                    rec_ptr->get_tidw_ref().lock();
-                    tid = loadAcquire(
-                            rec_ptr->get_tidw_ref().get_obj()); // reload
-                    if (check_cd()) {                           // re-check
-                        // update value
-                        std::string vb{};
-                        wso.get_value(vb);
-                        rec_ptr->get_latest()->set_value(vb);
-                        // unlock and set ctid
-                        rec_ptr->set_tid(ctid);
-                        break;
-                    }
-                    rec_ptr->get_tidw_ref().unlock();
-                }
-                [[fallthrough]]; // upsert is update
-            }
-            case OP_TYPE::DELETE: {
-                if (wso.get_op() == OP_TYPE::DELETE) { // for fallthrough
-                    if (rec_ptr->get_shared_tombstone_count() == 0) {
-                        ctid.set_latest(false);
-                        ctid.set_absent(true);
-                    } else { // consider for sharing tombstone by insert, block gc
-                        ctid.set_latest(true);
-                        ctid.set_absent(true);
-                    }
+/**
+ * @brief the result of exposing a part of the write set.
+ */
+struct expose_partition {
+    std::unordered_set<Storage> dirty_{};
+    std::map<Storage, std::tuple<std::string, std::string>> write_range_{};
+    wp::durability_cache durability_{};
+    /**
+     * @brief the result of exposing this part.
+     */
+    Status rc_{Status::OK};
+#ifdef PWAL
+    /**
+     * @brief the local wal buffer if this part is exposed by the committing
+     * thread, which holds the mutex of it. Otherwise nullptr.
+     */
+    lpwal::handler* handle_{};
+    /**
+     * @brief log records of this part exposed by the thread pool. They are
+     * pushed to the local wal buffer by the committing thread.
+     */
+    std::vector<lpwal::log_record> logs_{};
+#endif
+};
+
+/**
+ * @brief The minimum number of write set entries of a part exposed by the
+ * thread pool. The smaller write set is exposed by the committing thread.
+ */
+static constexpr std::size_t expose_partition_min_size{4096};
+
+static Status expose_local_write_one( // NOLINT
+        session* const ti, bool const should_backward,
+        std::pair<Record* const, write_set_obj>& wse, tid_word ctid,
+        expose_partition& out) {
+    auto* rec_ptr = std::get<0>(wse);
+    auto&& wso = std::get<1>(wse);
+    out.dirty_.insert(wso.get_storage());
+    [[maybe_unused]] bool should_log{true};
+    // bw can backward including occ bw
+    switch (wso.get_op()) {
+        case OP_TYPE::UPSERT:
+        case OP_TYPE::INSERT: {
+            // about tombstone count
+            if (wso.get_inc_tombstone()) {
+                auto* rec_ptr = wso.get_rec_ptr();
+                rec_ptr->get_tidw_ref().lock();
+                if (rec_ptr->get_shared_tombstone_count() == 0) {
+                    LOG_FIRST_N(ERROR, 1)
+                            << log_location_prefix << "unreachable path.";
+                } else {
+                    --rec_ptr->get_shared_tombstone_count();
                 }
-                [[fallthrough]];
+                rec_ptr->get_tidw_ref().unlock();
             }
-            case OP_TYPE::UPDATE: {
+
+            tid_word tid{loadAcquire(rec_ptr->get_tidw_ref().get_obj())};
+            auto check_cd = [&tid]() {
+                return tid.get_absent() && // inserting or deleted
+                       // DELETE'd Record (not-absent -> deleted) has non-zero epoch/tid
+                       tid.get_epoch() == 0 && tid.get_tid() == 0;
+            };
+            if (check_cd()) {
                 // lock record
                 rec_ptr->get_tidw_ref().lock();
-                tid_word pre_tid{rec_ptr->get_tidw_ref().get_obj()};
-
-                if (ti->get_valid_epoch() > pre_tid.get_epoch()) {
-                    // case: first of list
-                    std::string vb{};
-                    if (wso.get_op() != OP_TYPE::DELETE) { wso.get_value(vb); }
-                    version* new_v{new version( // NOLINT
-                            vb, rec_ptr->get_latest())};
-                    // prepare tid for old version
-                    pre_tid.set_absent(false);
-                    pre_tid.set_latest(false);
-                    pre_tid.set_lock(false);
-                    // set old version tid
-                    rec_ptr->get_latest()->set_tid(pre_tid);
-                    // set latest
-                    rec_ptr->set_latest(new_v);
-                    // unlock and set ctid
-                    rec_ptr->set_tid(ctid);
-                } else if (ti->get_valid_epoch() == pre_tid.get_epoch()) {
-                    if (should_backward && !pre_tid.get_by_short() &&
-                        ti->get_long_tx_id() > pre_tid.get_tid()) {
-                        /**
-                         * non invisible write due to
-                         * 1: write only
-                         * 2: no waiting bypass and no forwarding
-                         */
-                        should_log = true;
-                        std::string vb{};
-                        wso.get_value(vb);
-                        rec_ptr->get_latest()->set_value(vb);
-                    } else {
-                        // invisible write
-                        should_log = false;
-                        // keep tx id and by_short bit for successor invisible write
-
-                        ctid.set_tid(pre_tid.get_tid());
-                        ctid.set_by_short(pre_tid.get_by_short());
-                        // keep entry status (existing, deleted)
-                        ctid.set_latest(pre_tid.get_latest());
-                        ctid.set_absent(pre_tid.get_absent());
-                    }
+                tid = loadAcquire(
+                        rec_ptr->get_tidw_ref().get_obj()); // reload
+                if (check_cd()) {                           // re-check
+                    // update value
+                    rec_ptr->get_latest()->set_value(wso.get_value_view());
                     // unlock and set ctid
                     rec_ptr->set_tid(ctid);
+                    break;
+                }
+                rec_ptr->get_tidw_ref().unlock();
+            }
+            [[fallthrough]]; // upsert is update
+        }
+        case OP_TYPE::DELETE: {
+            if (wso.get_op() == OP_TYPE::DELETE) { // for fallthrough
+                if (rec_ptr->get_shared_tombstone_count() == 0) {
+                    ctid.set_latest(false);
+                    ctid.set_absent(true);
+                } else { // consider for sharing tombstone by insert, block gc
+                    ctid.set_latest(true);
+                    ctid.set_absent(true);
+                }
+            }
+            [[fallthrough]];
+        }
+        case OP_TYPE::UPDATE: {
+            // lock record
+            rec_ptr->get_tidw_ref().lock();
+            tid_word pre_tid{rec_ptr->get_tidw_ref().get_obj()};
+
+            if (ti->get_valid_epoch() > pre_tid.get_epoch()) {
+                // case: first of list
+                std::string_view vb{};
+                if (wso.get_op() != OP_TYPE::DELETE) {
+                    vb = wso.get_value_view();
+                }
+                version* new_v{new version( // NOLINT
+                        vb, rec_ptr->get_latest())};
+                // prepare tid for old version
+                pre_tid.set_absent(false);
+                pre_tid.set_latest(false);
+                pre_tid.set_lock(false);
+                // set old version tid
+                rec_ptr->get_latest()->set_tid(pre_tid);
+                // set latest
+                rec_ptr->set_latest(new_v);
+                // unlock and set ctid
+                rec_ptr->set_tid(ctid);
+            } else if (ti->get_valid_epoch() == pre_tid.get_epoch()) {
+                if (should_backward && !pre_tid.get_by_short() &&
+                    ti->get_long_tx_id() > pre_tid.get_tid()) {
+                    /**
+                     * non invisible write due to
+                     * 1: write only
+                     * 2: no waiting bypass and no forwarding
+                     */
+                    should_log = true;
+                    rec_ptr->get_latest()->set_value(wso.get_value_view());
                 } else {
-                    // case: middle of list
-                    auto version_creation = [&wso, ctid](version* pre_ver,
-                                                         version* ver) {
-                        std::string vb{};
-                        if (wso.get_op() != OP_TYPE::DELETE) {
-                            // load payload if not delete.
-                            wso.get_value(vb);
-                        }
-                        version* new_v{new version(ctid, vb, ver)}; // NOLINT
-                        pre_ver->set_next(new_v);
-                    };
+                    // invisible write
                     should_log = false;
-                    version* pre_ver{rec_ptr->get_latest()};
-                    version* ver{rec_ptr->get_latest()->get_next()};
-                    for (;;) {
-                        if (ver == nullptr) {
-                            // version creation
-                            version_creation(pre_ver, ver);
-                            break;
-                        }
-                        // checking version exist. check tid.
-                        tid_word tid{ver->get_tid()};
-                        if (tid.get_epoch() < ti->get_valid_epoch()) {
-                            // version creation
-                            version_creation(pre_ver, ver);
-                            break;
-                        }
-                        if (tid.get_epoch() == ti->get_valid_epoch()) {
-                            // para (partial order) write, normally invisible write
-                            if (should_backward && !tid.get_by_short() &&
-                                ti->get_long_tx_id() > tid.get_tid()) {
-                                // non invisible write due to bypass read wait
-                                std::string vb{};
-                                wso.get_value(vb);
-                                // set value
-                                ver->set_value(vb);
-                                ver->set_tid(ctid);
-                            }
-                            // else: omit due to forwarding
-                            break;
+                    // keep tx id and by_short bit for successor invisible write
+
+                    ctid.set_tid(pre_tid.get_tid());
+                    ctid.set_by_short(pre_tid.get_by_short());
+                    // keep entry status (existing, deleted)
+                    ctid.set_latest(pre_tid.get_latest());
+                    ctid.set_absent(pre_tid.get_absent());
+                }
+                // unlock and set ctid
+                rec_ptr->set_tid(ctid);
+            } else {
+                // case: middle of list
+                auto version_creation = [&wso, ctid](version* pre_ver,
+                                                     version* ver) {
+                    std::string_view vb{};
+                    if (wso.get_op() != OP_TYPE::DELETE) {
+                        // load payload if not delete.
+                        vb = wso.get_value_view();
+                    }
+                    version* new_v{new version(ctid, vb, ver)}; // NOLINT
+                    pre_ver->set_next(new_v);
+                };
+                should_log = false;
+                version* pre_ver{rec_ptr->get_latest()};
+                version* ver{rec_ptr->get_latest()->get_next()};
+                for (;;) {
+                    if (ver == nullptr) {
+                        // version creation
+                        version_creation(pre_ver, ver);
+                        break;
+                    }
+                    // checking version exist. check tid.
+                    tid_word tid{ver->get_tid()};
+                    if (tid.get_epoch() < ti->get_valid_epoch()) {
+                        // version creation
+                        version_creation(pre_ver, ver);
+                        break;
+                    }
+                    if (tid.get_epoch() == ti->get_valid_epoch()) {
+                        // para (partial order) write, normally invisible write
+                        if (should_backward && !tid.get_by_short() &&
+                            ti->get_long_tx_id() > tid.get_tid()) {
+                            // non invisible write due to bypass read wait
+                            // set value
+                            ver->set_value(wso.get_value_view());
+                            ver->set_tid(ctid);
                         }
-                        pre_ver = ver;
-                        ver = ver->get_next();
+                        // else: omit due to forwarding
+                        break;
                     }
-                    rec_ptr->get_tidw_ref().unlock();
+                    pre_ver = ver;
+                    ver = ver->get_next();
                 }
+                rec_ptr->get_tidw_ref().unlock();
+            }
+            break;
+        }
+        default: {
+            LOG_FIRST_N(ERROR, 1)
+                    << log_location_prefix << "unknown operation type.";
+            break;
+        }
+    }
+#ifdef PWAL
+    // the writes to non-durable storage are not logged
+    if (should_log && out.durability_.is_durable(wso.get_storage())) {
+        // add log records to local wal buffer
+        std::string key{};
+        wso.get_rec_ptr()->get_key(key);
+        // the value is no longer needed by the write set, so take it over.
+        std::string val{wso.release_value()};
+        log_operation lo{};
+        switch (wso.get_op()) {
+            case OP_TYPE::INSERT: {
+                lo = log_operation::INSERT;
+                break;
+            }
+            case OP_TYPE::UPDATE: {
+                lo = log_operation::UPDATE;
+                break;
+            }
+            case OP_TYPE::UPSERT: {
+                lo = log_operation::UPSERT;
+                break;
+            }
+            case OP_TYPE::DELETE: {
+                lo = log_operation::DELETE;
                 break;
             }
             default: {
                 LOG_FIRST_N(ERROR, 1)
                         << log_location_prefix << "unknown operation type.";
-                break;
+                return Status::ERR_FATAL;
             }
         }
-#ifdef PWAL
-        if (should_log) {
-            // add log records to local wal buffer
-            std::string key{};
-            wso.get_rec_ptr()->get_key(key);
-            std::string val{};
-            wso.get_value(val);
-            log_operation lo{};
-            switch (wso.get_op()) {
-                case OP_TYPE::INSERT: {
-                    lo = log_operation::INSERT;
-                    break;
-                }
-                case OP_TYPE::UPDATE: {
-                    lo = log_operation::UPDATE;
-                    break;
-                }
-                case OP_TYPE::UPSERT: {
-                    lo = log_operation::UPSERT;
-                    break;
-                }
-                case OP_TYPE::DELETE: {
-                    lo = log_operation::DELETE;
-                    break;
-                }
-                default: {
-                    LOG_FIRST_N(ERROR, 1)
-                            << log_location_prefix << "unknown operation type.";
-                    return Status::ERR_FATAL;
-                }
-            }
-            ti->get_lpwal_handle().push_log(shirakami::lpwal::log_record(
-                    lo,
-                    lpwal::write_version_type(ti->get_valid_epoch(),
-                                              ti->get_long_tx_id()),
-                    wso.get_storage(), key, val, wso.get_lobs()));
+        shirakami::lpwal::log_record log{
+                lo,
+                lpwal::write_version_type(ti->get_valid_epoch(),
+                                          ti->get_long_tx_id()),
+                wso.get_storage(), std::move(key), std::move(val),
+                wso.get_lobs()};
+        if (out.handle_ != nullptr) {
+            out.handle_->push_log(std::move(log));
+        } else {
+            out.logs_.emplace_back(std::move(log));
         }
+    }
 #endif
-        return Status::OK;
-    };
+    return Status::OK;
+}
 
+/**
+ * @brief expose the part of the write set.
+ * @details The result is set to expose_partition::rc_. It stops at the first
+ * failure.
+ */
+static void expose_local_write_range(
+        session* const ti, bool const should_backward, tid_word const ctid,
+        local_write_set::cont_for_bt_type::iterator const begin,
+        local_write_set::cont_for_bt_type::iterator const end,
+        expose_partition& out) {
+    auto& write_range = out.write_range_;
+    for (auto itr = begin; itr != end; ++itr) {
+        auto& wso = *itr;
+        std::string_view pkey_view = wso.second.get_rec_ptr()->get_key_view();
+        auto wr_itr = write_range.find(wso.second.get_storage());
+        if (wr_itr != write_range.end()) {
+            // found
+            // more than one write
+            if (pkey_view < std::get<0>(wr_itr->second)) {
+                std::get<0>(wr_itr->second) = pkey_view;
+            }
+            if (pkey_view > std::get<1>(wr_itr->second)) {
+                std::get<1>(wr_itr->second) = pkey_view;
+            }
+        } else {
+            // not found
+            write_range.insert(std::make_pair(
+                    wso.second.get_storage(),
+                    std::make_tuple(std::string(pkey_view),
+                                    std::string(pkey_view))));
+        }
+        out.rc_ = expose_local_write_one(ti, should_backward, wso, ctid, out);
+        if (out.rc_ != Status::OK) { return; }
+    }
+}
+
+/**
+ * @brief the parts of the write set exposed by the committing thread and the
+ * thread pool together.
+ * @details The committing thread exposes the first part, and then takes the
+ * other parts which the thread pool didn't take yet, so it doesn't idle while
+ * the pool is busy. The pool signals the completion of each part by the
+ * condition variable, on which the committing thread (the user thread or the
+ * bg_commit worker) waits. The pool tasks share the ownership of this, so a
+ * task which runs after all the parts were taken is harmless.
+ */
+struct expose_job {
+    using iterator = local_write_set::cont_for_bt_type::iterator;
+
+    expose_job(session* const ti, bool const should_backward,
+               tid_word const ctid)
+        : ti_(ti), should_backward_(should_backward), ctid_(ctid) {}
+
+    /**
+     * @brief expose the parts which are not taken yet except the first one.
+     */
+    void run_parts() {
+        for (;;) {
+            auto const i = next_.fetch_add(1, std::memory_order_acq_rel);
+            if (i >= parts_.size()) { return; }
+            expose_local_write_range(ti_, should_backward_, ctid_,
+                                     ranges_.at(i).first,
+                                     ranges_.at(i).second, parts_.at(i));
+            {
+                std::lock_guard<std::mutex> lk{mtx_done_};
+                ++done_;
+            }
+            cv_done_.notify_one();
+        }
+    }
+
+    /**
+     * @brief wait for the parts exposed by the thread pool.
+     */
+    void wait_parts() {
+        std::unique_lock<std::mutex> lk{mtx_done_};
+        cv_done_.wait(lk, [this] { return done_ + 1 == parts_.size(); });
+    }
+
+    session* ti_;
+    bool should_backward_;
+    tid_word ctid_;
+    std::vector<expose_partition> parts_{};
+    std::vector<std::pair<iterator, iterator>> ranges_{};
+    /**
+     * @brief the next part to be taken. The first part is exposed by the
+     * committing thread.
+     */
+    std::atomic<std::size_t> next_{1};
+    std::mutex mtx_done_{};
+    std::condition_variable cv_done_{};
+    /**
+     * @brief the number of the exposed parts except the first one.
+     */
+    std::size_t done_{0};
+};
+
+/**
+ * @return Status::OK success.
+ * @return Status::ERR_FATAL some write has the unknown operation type.
+ */
+static inline Status expose_local_write(
+        session* ti, tid_word& committed_id,
+        std::map<Storage, std::tuple<std::string, std::string>>& write_range) {
+    tid_word ctid{};
+    compute_tid(ti, ctid);
+    committed_id = ctid;
+
+    //bool should_backward{ti->is_write_only_ltx_now()};
+    bool should_backward{!ti->get_is_forwarding()};
+
+    auto job = std::make_shared<expose_job>(ti, should_backward, ctid);
+    auto& parts = job->parts_;
     {
 #ifdef PWAL
         std::unique_lock<std::mutex> lk0{ti->get_lpwal_handle().get_mtx_logs()};
 #endif
         std::shared_lock<std::shared_mutex> lk{ti->get_write_set().get_mtx()};
-        for (auto&& wso : ti->get_write_set().get_ref_cont_for_bt()) {
-            std::string_view pkey_view =
-                    wso.second.get_rec_ptr()->get_key_view();
-            auto wr_itr = write_range.find(wso.second.get_storage());
-            if (wr_itr != write_range.end()) {
-                // found
-                // more than one write
-                if (pkey_view < std::get<0>(wr_itr->second)) {
-                    std::get<0>(wr_itr->second) = pkey_view;
-                }
-                if (pkey_view > std::get<1>(wr_itr->second)) {
-                    std::get<1>(wr_itr->second) = pkey_view;
-                }
+        auto& cont = ti->get_write_set().get_ref_cont_for_bt();
+
+        /**
+         * Each entry is a different record, so the parts of the write set can
+         * be exposed in parallel.
+         */
+        std::size_t num_parts{1};
+        if (thread_pool::get_running()) {
+            num_parts = std::min(thread_pool::get_thread_pool_size() + 1,
+                                 cont.size() / expose_partition_min_size);
+            num_parts = std::max(num_parts, static_cast<std::size_t>(1));
+        }
+        parts.resize(num_parts);
+#ifdef PWAL
+        // the committing thread pushes the log records of its part directly
+        parts.front().handle_ = &ti->get_lpwal_handle();
+#endif
+        auto part_begin = cont.begin();
+        std::size_t const part_size{cont.size() / num_parts};
+        for (std::size_t i = 0; i < num_parts; ++i) {
+            auto part_end = part_begin;
+            if (i == num_parts - 1) {
+                part_end = cont.end();
             } else {
-                // not found
-                write_range.insert(std::make_pair(
-                        wso.second.get_storage(),
-                        std::make_tuple(std::string(pkey_view),
-                                        std::string(pkey_view))));
+                std::advance(part_end, part_size);
+            }
+            job->ranges_.emplace_back(part_begin, part_end);
+            part_begin = part_end;
+        }
+
+        // the pool releases the tasks
+        for (std::size_t i = 1; i < num_parts; ++i) {
+            auto* task = new thread_task(); // NOLINT
+            task->set_task_kind(task_kind::LTX_EXPOSE_LOCAL_WRITE);
+            task->set_token(static_cast<Token>(ti));
+            task->set_released_by_pool(true);
+            task->set_body([job]() { job->run_parts(); });
+            thread_pool::push_task_queue(task);
+        }
+        expose_local_write_range(ti, should_backward, ctid,
+                                 job->ranges_.front().first,
+                                 job->ranges_.front().second, parts.front());
+        if (num_parts > 1) {
+            job->run_parts();
+            job->wait_parts();
+        }
+
+        // merge the results
+#ifdef PWAL
+        for (auto&& part : parts) {
+            for (auto&& log : part.logs_) {
+                ti->get_lpwal_handle().push_log(std::move(log));
+            }
+        }
+#endif
+    }
+    Status rc{Status::OK};
+    std::unordered_set<Storage> dirty{};
+    for (auto&& part : parts) {
+        if (part.rc_ != Status::OK) { rc = part.rc_; }
+        dirty.merge(part.dirty_);
+        for (auto&& elem : part.write_range_) {
+            auto wr_itr = write_range.find(elem.first);
+            if (wr_itr == write_range.end()) {
+                write_range.emplace(elem.first, std::move(elem.second));
+                continue;
+            }
+            if (std::get<0>(elem.second) < std::get<0>(wr_itr->second)) {
+                std::get<0>(wr_itr->second) = std::get<0>(elem.second);
+            }
+            if (std::get<1>(elem.second) > std::get<1>(wr_itr->second)) {
+                std::get<1>(wr_itr->second) = std::get<1>(elem.second);
             }
-            process(wso, ctid);
         }
     }
     garbage::set_dirty(dirty);
+    return rc;
 }
 
 static inline void register_wp_result_and_remove_wps(
@@ -387,6 +582,9 @@ static inline void cleanup_process(
     // clear about read plan
     read_plan::remove_elem(ti->get_long_tx_id());
 
+    // wake up the transactions waiting for this
+    bg_work::bg_commit::notify_finish(ti->get_long_tx_id());
+
     // local effect
     ti->clean_up();
 }
@@ -413,6 +611,8 @@ Status abort(session* const ti) { // NOLINT
 
 static void register_read_by(session* const ti) {
     // point read
+    // the same record may be read many times, register it once.
+    ti->read_set_for_ltx().sort_and_unique();
     // register to page info
     {
         // take read lock
@@ -691,6 +891,10 @@ extern Status commit(session* const ti) {
 
     // update read area
     update_read_area(ti);
+    if (!ti->get_requested_commit()) {
+        // the read area was fixed, wake up the transactions waiting for read
+        bg_work::bg_commit::notify_read_area_update(ti->get_long_tx_id());
+    }
 
     // detail info
     if (logging::get_enable_logging_detail_info()) {
@@ -802,7 +1006,12 @@ extern Status commit(session* const ti) {
          * So it needs boolean.
          */
         std::map<Storage, std::tuple<std::string, std::string>> write_range;
-        expose_local_write(ti, ctid, write_range);
+        rc = expose_local_write(ti, ctid, write_range);
+        if (rc != Status::OK) {
+            LOG_FIRST_N(ERROR, 1) << log_location_prefix
+                                  << "library programming error. " << rc;
+            return rc;
+        }
 
         // log debug timing event
         VLOG(log_debug_timing_event)
@@ -0,0 +1,85 @@
+
+#include "storage.h"
+
+#include "concurrency_control/include/session.h"
+#include "concurrency_control/interface/include/helper.h"
+#include "database/include/logging.h"
+
+#include "index/yakushima/include/interface.h"
+
+#include "shirakami/interface.h"
+#include "shirakami/logging.h"
+
+namespace shirakami {
+
+static Status merge_body(Token token, Storage storage,
+                         std::string_view const key,
+                         std::string_view const operand) {
+    // check constraint: key
+    auto ret = check_constraint_key_length(key);
+    if (ret != Status::OK) { return ret; }
+
+    // take thread info
+    auto* ti = static_cast<session*>(token);
+
+    // check whether it already began.
+    if (!ti->get_tx_began()) { return Status::WARN_NOT_BEGIN; }
+
+    // it is resolved at occ commit phase
+    if (ti->get_tx_type() != transaction_options::transaction_type::SHORT) {
+        return Status::WARN_ILLEGAL_OPERATION;
+    }
+
+    // check for write
+    auto rc{check_before_write_ops(ti, storage, key, OP_TYPE::UPDATE)};
+    if (rc != Status::OK) { return rc; }
+
+    merge_operator_type op{};
+    if (storage::merge_operator_map_get(storage, op) != Status::OK) {
+        return Status::WARN_INVALID_ARGS;
+    }
+
+    // index access to check local write set
+    Record* rec_ptr{};
+    if (Status::OK == get<Record>(storage, key, rec_ptr)) {
+        // check local write
+        write_set_obj* in_ws{ti->get_write_set().search(rec_ptr)}; // NOLINT
+        if (in_ws != nullptr) {
+            if (in_ws->get_op() == OP_TYPE::DELETE) {
+                return Status::WARN_NOT_FOUND;
+            }
+            in_ws->merge(op, operand);
+            return Status::OK;
+        }
+
+        // check absent
+        tid_word ctid{loadAcquire(rec_ptr->get_tidw_ref().get_obj())};
+        if (ctid.get_absent()) { return Status::WARN_NOT_FOUND; }
+
+        // prepare write without read
+        write_set_obj wso{storage, OP_TYPE::UPDATE, rec_ptr, {}, false, {}};
+        wso.set_merge(std::move(op), operand);
+        ti->push_to_write_set(std::move(wso));
+        return Status::OK;
+    }
+    return Status::WARN_NOT_FOUND;
+}
+
+Status merge(Token token, Storage storage, std::string_view const key,
+             std::string_view const operand) {
+    shirakami_log_entry << "merge, token: " << token << ", storage: " << storage
+                        << "," shirakami_binstring(key) "," shirakami_binstring(operand);
+    auto* ti = static_cast<session*>(token);
+    ti->process_before_start_step();
+    Status ret{};
+    { // for strand
+        std::shared_lock<std::shared_mutex> lock{ti->get_mtx_state_da_term()};
+
+        ret = merge_body(token, storage, key, operand);
+    }
+    ti->process_before_finish_step();
+    shirakami_log_exit << "merge, Status: " << ret;
+    return ret;
+}
+
+} // namespace shirakami
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "concurrency_control/include/session.h"
+#include "concurrency_control/include/shared_snapshot.h"
 
 #include "shirakami/scheme.h"
 
@@ -13,6 +14,19 @@ extern Status commit(session* ti);
 extern Status search_key(session* ti, Storage storage, std::string_view key,
                          std::string& value, bool read_value = true); // NOLINT
 
-extern Status tx_begin(session* ti);
+/**
+ * @brief open the snapshot shared among rtxs.
+ * @param[out] out the opened snapshot.
+ * @return Status::OK success.
+ */
+extern Status open_snapshot(shared_snapshot*& out);
+
+/**
+ * @param[in] ss the shared snapshot which this tx is attached to. If it is
+ * nullptr, this tx decides its own snapshot.
+ * @return Status::OK success.
+ * @return Status::WARN_INVALID_HANDLE @a ss is not opened.
+ */
+extern Status tx_begin(session* ti, shared_snapshot* ss = nullptr);
 
 } // namespace shirakami::read_only_tx
@@ -3,6 +3,7 @@
 
 #include "concurrency_control/include/long_tx.h"
 #include "concurrency_control/include/ongoing_tx.h"
+#include "concurrency_control/include/shared_snapshot.h"
 #include "concurrency_control/include/wp.h"
 #include "concurrency_control/interface/long_tx/include/long_tx.h"
 
@@ -11,6 +12,9 @@ namespace shirakami::read_only_tx {
 static inline void cleanup_process(session* const ti) {
     // global effect
     ongoing_tx::remove_id(ti->get_long_tx_id());
+    if (ti->get_shared_snapshot() != nullptr) {
+        shared_snapshot::detach(ti->get_shared_snapshot());
+    }
 
     // local effect
     ti->clean_up();
@@ -60,9 +64,44 @@ Status commit(session* const ti) {
     return Status::OK;
 }
 
-Status tx_begin(session* const ti) {
+/**
+ * @brief compute the snapshot epoch for the rtx which begins now.
+ * @pre This is called with wp mutex and ongoing tx mutex.
+ */
+static epoch::epoch_t compute_snapshot_epoch() {
+    if (ongoing_tx::get_tx_info().empty()) {
+        /**
+         * No ltx case:
+         * If this set from cc_safe_ss_epoch, next epoch update, epoch
+         * manager may check this tx as oldest ltx and not update
+         * cc_safe_ss_epoch. If this is chain, cc_safe_ss_epoch will not be
+         * updated.
+         *
+         */
+        return epoch::get_global_epoch() + 1;
+    }
+    // Exist ltx.
+    return epoch::get_cc_safe_ss_epoch();
+}
+
+Status open_snapshot(shared_snapshot*& out) {
     // exclude long tx's coming and epoch update
     auto wp_mutex = std::unique_lock<std::mutex>(wp::get_wp_mutex());
+    std::shared_lock<std::shared_mutex> lk{ongoing_tx::get_mtx()};
+    shared_snapshot::open(compute_snapshot_epoch(), out);
+    return Status::OK;
+}
+
+Status tx_begin(session* const ti, shared_snapshot* const ss) {
+    // exclude long tx's coming and epoch update
+    auto wp_mutex = std::unique_lock<std::mutex>(wp::get_wp_mutex());
+
+    // attach to the shared snapshot
+    if (ss != nullptr) {
+        auto rc = shared_snapshot::attach(ss);
+        if (rc != Status::OK) { return rc; }
+    }
+    ti->set_shared_snapshot(ss);
 
     // get long tx id
     auto long_tx_id = shirakami::wp::long_tx::get_counter();
@@ -72,22 +111,8 @@ Status tx_begin(session* const ti) {
         std::lock_guard<std::shared_mutex> lk{ongoing_tx::get_mtx()};
 
         // set epoch
-        auto ep = epoch::get_global_epoch() + 1;
-        if (ongoing_tx::get_tx_info().empty()) {
-            /**
-             * No ltx case:
-             * If this set from cc_safe_ss_epoch, next epoch update, epoch
-             * manager may check this tx as oldest ltx and not update
-             * cc_safe_ss_epoch. If this is chain, cc_safe_ss_epoch will not be
-             * updated.
-             *
-             */
-            ti->set_valid_epoch(ep);
-        } else {
-            // Exist ltx.
-            ep = epoch::get_cc_safe_ss_epoch();
-            ti->set_valid_epoch(ep);
-        }
+        auto ep = ss != nullptr ? ss->get_epoch() : compute_snapshot_epoch();
+        ti->set_valid_epoch(ep);
 
         // inc long tx counter
         wp::long_tx::set_counter(long_tx_id + 1);
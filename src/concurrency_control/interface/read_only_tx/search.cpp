@@ -22,7 +22,18 @@ Status search_key(session* const ti, Storage const storage,
         return Status::WARN_NOT_FOUND;
     }
 
-    return long_tx::version_traverse_and_read(ti, rec_ptr, value, read_value);
+    auto* ss = ti->get_shared_snapshot();
+    if (ss == nullptr) {
+        return long_tx::version_traverse_and_read(ti, rec_ptr, value,
+                                                  read_value);
+    }
+
+    // reuse the version resolved by the rtxs attached to the same snapshot
+    shared_snapshot::resolved_version rv{};
+    ss->resolve_version(rec_ptr, rv);
+    if (rv.absent_) { return Status::WARN_NOT_FOUND; }
+    if (read_value) { rv.ver_->get_value(value); }
+    return Status::OK;
 }
 
 } // namespace shirakami::read_only_tx
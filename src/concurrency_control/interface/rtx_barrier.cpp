@@ -0,0 +1,58 @@
+
+#include <future>
+
+#include "shirakami/api_rtx_barrier.h"
+
+#include "concurrency_control/include/epoch.h"
+#include "concurrency_control/include/epoch_internal.h"
+#include "database/include/logging.h"
+
+#include "shirakami/logging.h"
+
+#include "glog/logging.h"
+
+namespace shirakami {
+
+Status acquire_rtx_barrier(rtx_barrier_anchor_type& anchor) {
+    shirakami_log_entry << "acquire_rtx_barrier";
+    /**
+     * The transactions committed so far have the epoch up to the current
+     * epoch, so the snapshot of the next epoch includes them.
+     */
+    anchor = epoch::get_global_epoch() + 1;
+    shirakami_log_exit << "acquire_rtx_barrier, anchor: " << anchor;
+    return Status::OK;
+}
+
+Status check_rtx_barrier(rtx_barrier_anchor_type const anchor,
+                         bool& released) {
+    shirakami_log_entry << "check_rtx_barrier, anchor: " << anchor;
+    // rtx begins at cc_safe_ss_epoch or later
+    released = epoch::get_cc_safe_ss_epoch() >= anchor;
+    shirakami_log_exit << "check_rtx_barrier, released: " << released;
+    return Status::OK;
+}
+
+Status wait_rtx_barrier(rtx_barrier_anchor_type const anchor) {
+    shirakami_log_entry << "wait_rtx_barrier, anchor: " << anchor;
+    std::promise<bool> released{};
+    auto future = released.get_future();
+    epoch::add_rtx_barrier_waiter(
+            anchor, [&released](bool const tf) { released.set_value(tf); });
+    auto ret = future.get() ? Status::OK : Status::WARN_NOT_INIT;
+    shirakami_log_exit << "wait_rtx_barrier, Status: " << ret;
+    return ret;
+}
+
+Status wait_rtx_barrier(rtx_barrier_anchor_type const anchor,
+                        rtx_barrier_callback_type callback) {
+    shirakami_log_entry << "wait_rtx_barrier, anchor: " << anchor;
+    epoch::add_rtx_barrier_waiter(
+            anchor, [cb = std::move(callback)](bool const tf) {
+                cb(tf ? Status::OK : Status::WARN_NOT_INIT);
+            });
+    shirakami_log_exit << "wait_rtx_barrier, Status: " << Status::OK;
+    return Status::OK;
+}
+
+} // namespace shirakami
@@ -226,8 +226,9 @@ static Status open_scan_precheck(
         /**
          * early abort optimization. If it is not, it finally finds at commit phase.
          */
-        auto wps = wp::find_wp(storage);
-        auto find_min_ep{wp::wp_meta::find_min_ep(wps)};
+        auto wps = wp_meta_ptr->get_wped();
+        auto find_min_ep{wp_meta_ptr->find_min_ep_for_range(wps, l_key, l_end,
+                                                            r_key, r_end)};
         if (find_min_ep != 0 && find_min_ep <= epoch::get_global_epoch()) {
             short_tx::abort(ti);
             std::unique_lock<std::mutex> lk{ti->get_mtx_result_info()};
@@ -235,6 +236,9 @@ static Status open_scan_precheck(
             ti->set_result(reason_code::CC_OCC_WP_VERIFY);
             return Status::ERR_CC;
         }
+        // scan is expensive, so check reads so far before it.
+        auto rc = short_tx::early_read_verify(ti, true);
+        if (rc != Status::OK) { return rc; }
     } else if (ti->get_tx_type() ==
                transaction_options::transaction_type::LONG) {
         // wp verify and forwarding
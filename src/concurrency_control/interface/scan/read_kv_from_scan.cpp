@@ -93,7 +93,7 @@ static Status read_from_scan(Token token, ScanHandle handle, bool key_read,
      * Check read-own-write
      */
     if (ti->get_tx_type() != transaction_options::transaction_type::READ_ONLY) {
-        const write_set_obj* inws = ti->get_write_set().search(rec_ptr);
+        write_set_obj* inws = ti->get_write_set().search(rec_ptr);
         if (inws != nullptr) {
             if (inws->get_op() == OP_TYPE::DELETE) {
                 read_register_if_ltx(rec_ptr);
@@ -102,6 +102,10 @@ static Status read_from_scan(Token token, ScanHandle handle, bool key_read,
             if (key_read) {
                 inws->get_key(buf);
             } else {
+                if (inws->get_rmw() == write_set_obj::rmw_kind::MERGE) {
+                    auto rc = short_tx::resolve_merge_by_read(ti, inws);
+                    if (rc != Status::OK) { return rc; }
+                }
                 std::shared_lock<std::shared_mutex> lk{
                         rec_ptr->get_mtx_value()};
                 inws->get_value(buf);
@@ -135,4 +135,59 @@ Status search_key(Token const token, Storage const storage, // NOLINT
     return ret;
 }
 
+static Status search_key_batch_body(Token const token, Storage const storage,
+                                    std::string_view const* const keys,
+                                    std::string* const values,
+                                    Status* const statuses,
+                                    std::size_t const size) {
+    auto* ti = static_cast<session*>(token);
+    if (!ti->get_tx_began()) { return Status::WARN_NOT_BEGIN; }
+    if (size == 0) { return Status::OK; }
+
+    transaction_options::transaction_type this_tx_type{ti->get_tx_type()};
+    if (this_tx_type != transaction_options::transaction_type::SHORT) {
+        // long and read only tx search key by key
+        for (std::size_t i = 0; i < size; ++i) {
+            statuses[i] = search_key_body(token, storage, keys[i], // NOLINT
+                                          values[i]);              // NOLINT
+            if (statuses[i] > Status::OK) { return statuses[i]; } // NOLINT
+        }
+        return Status::OK;
+    }
+
+    auto rc = short_tx::search_key_batch(ti, storage, keys, values, statuses,
+                                         size);
+    if (rc <= Status::OK) {
+        // It is not error by this strand thread, check termination
+        std::unique_lock<std::mutex> lk{ti->get_mtx_termination()};
+        if (ti->get_result_info().get_reason_code() != reason_code::UNKNOWN) {
+            // but concurrent strand thread failed
+            short_tx::abort(ti);
+            rc = Status::ERR_CC;
+        }
+    }
+    return rc;
+}
+
+Status search_key_batch(Token const token, Storage const storage,
+                        std::string_view const* const keys,
+                        std::string* const values, Status* const statuses,
+                        std::size_t const size) {
+    shirakami_log_entry << "search_key_batch, token: " << token
+                        << ", storage: " << storage << ", size: " << size;
+    auto* ti = static_cast<session*>(token);
+    ti->process_before_start_step();
+    Status ret{};
+    { // for strand
+        std::shared_lock<std::shared_mutex> lock{ti->get_mtx_state_da_term(), std::defer_lock};
+        if (ti->get_mutex_flags().do_readaccess_daterm()) { lock.lock(); }
+
+        ret = search_key_batch_body(token, storage, keys, values, statuses,
+                                    size);
+    }
+    ti->process_before_finish_step();
+    shirakami_log_exit << "search_key_batch, Status: " << ret;
+    return ret;
+}
+
 } // namespace shirakami
@@ -13,7 +13,70 @@ extern Status abort(session* ti);
 
 extern Status commit(session* ti);
 
+/**
+ * @brief commit the short transactions in one batch.
+ * @details They are validated and committed one by one in the order of @a
+ * tis. The short expose lock of the first one is taken once for all of them
+ * instead of the lock of each, and their log records are put into its local
+ * wal buffer, so the batch is logged in one session of the log channel and
+ * flushed once. Each result is notified by the commit callback of the tx.
+ * @param[in] tis the transactions. All of them are began short transactions
+ * and appear at most once.
+ * @param[out] results the result of each transaction in the same order.
+ */
+extern void commit_batch(std::vector<session*> const& tis,
+                         std::vector<Status>& results);
+
+/**
+ * @brief flush the local log buffer if it should not be kept.
+ */
+extern void flush_log_if_needed(session* ti);
+
+/**
+ * @brief verify the read set during read phase.
+ * @details It is enabled by SHIRAKAMI_OCC_EARLY_READ_VERIFY_INTERVAL. It
+ * verifies the read set every the interval operations, or at once if
+ * @a force is true. It detects only reads which were already overwritten by
+ * committed transactions, so it never aborts the transaction which can
+ * commit.
+ * @param[in] ti
+ * @param[in] force If this is true, it verifies regardless of the number of
+ * operations. It is for before expensive operations like scan.
+ * @return Status::OK the read set is valid or the verification was skipped.
+ * @return Status::ERR_CC the read set is invalid and this transaction was
+ * aborted with reason_code::CC_OCC_READ_VERIFY.
+ */
+extern Status early_read_verify(session* ti, bool force = false); // NOLINT
+
+/**
+ * @brief fix the value of the pending merge in the write set by reading the
+ * record.
+ * @details It is for read own write of merge. The read is registered to the
+ * read set, so it is verified at commit phase.
+ * @param[in] ti
+ * @param[in] wso the write which has the pending merge.
+ * @return Status::OK success.
+ * @return Status::WARN_CONCURRENT_INSERT the record is being inserted.
+ * @return Status::WARN_CONCURRENT_UPDATE the record is locked.
+ * @return Status::WARN_NOT_FOUND the record was deleted.
+ */
+extern Status resolve_merge_by_read(session* ti, write_set_obj* wso);
+
 extern Status search_key(session* ti, Storage storage, std::string_view key,
                          std::string& value, bool read_value = true); // NOLINT
 
+/**
+ * @brief search the keys in the storage.
+ * @details The wp check and the early read verify are done once for the
+ * batch.
+ * @return Status::OK all keys were searched. The result of each key is in
+ * @a statuses.
+ * @return otherwise the error which aborted this transaction, or the warning
+ * about the storage.
+ */
+extern Status search_key_batch(session* ti, Storage storage,
+                               std::string_view const* keys,
+                               std::string* values, Status* statuses,
+                               std::size_t size);
+
 } // namespace shirakami::short_tx
@@ -1,10 +1,13 @@
 
+#include <algorithm>
+#include <array>
 #include <string_view>
 
 #include "concurrency_control/include/helper.h"
 #include "concurrency_control/include/session.h"
 #include "concurrency_control/include/version.h"
 #include "concurrency_control/include/wp.h"
+#include "concurrency_control/interface/include/helper.h"
 #include "concurrency_control/interface/short_tx/include/short_tx.h"
 
 #include "index/yakushima/include/interface.h"
@@ -17,56 +20,91 @@
 
 namespace shirakami::short_tx {
 
-static inline Status wp_verify(session* const ti, Storage const st) {
+/**
+ * @brief abort @a ti because of the write preserve found by the verify.
+ * @return Status::ERR_CC
+ */
+static inline Status abort_by_wp_verify(session* const ti) {
+    std::unique_lock<std::mutex> lk{ti->get_mtx_termination()};
+    short_tx::abort(ti);
+    ti->set_result(reason_code::CC_OCC_WP_VERIFY);
+    return Status::ERR_CC;
+}
+
+/**
+ * @brief verify wp for reading keys from @a l_key to @a r_key (both
+ * inclusive).
+ */
+static inline Status wp_verify(session* const ti, Storage const st,
+                               std::string_view const l_key,
+                               std::string_view const r_key) {
     wp::wp_meta* wm{};
     auto rc{wp::find_wp_meta(st, wm)};
     if (rc != Status::OK) { return Status::WARN_STORAGE_NOT_FOUND; }
     auto wps{wm->get_wped()};
-    auto find_min_ep{wp::wp_meta::find_min_ep(wps)};
+    auto find_min_ep{wm->find_min_ep_for_range(wps, l_key,
+                                               scan_endpoint::INCLUSIVE, r_key,
+                                               scan_endpoint::INCLUSIVE)};
     if (find_min_ep != 0 && find_min_ep <= epoch::get_global_epoch()) {
-        std::unique_lock<std::mutex> lk{ti->get_mtx_termination()};
-        short_tx::abort(ti);
-        ti->set_result(reason_code::CC_OCC_WP_VERIFY);
-        return Status::ERR_CC;
+        return abort_by_wp_verify(ti);
     }
     return Status::OK;
 }
 
-Status search_key(session* ti, Storage const storage,
-                  std::string_view const key, std::string& value,
-                  bool const read_value) {
-    // check wp
-    auto rc{wp_verify(ti, storage)};
-    if (rc != Status::OK) { return rc; }
+Status resolve_merge_by_read(session* const ti, write_set_obj* const wso) {
+    Record* rec_ptr{wso->get_rec_ptr()};
+    tid_word read_tid{};
+    std::string current{};
+    auto rs{read_record(rec_ptr, read_tid, current)};
+    if (rs == Status::WARN_CONCURRENT_UPDATE) { return rs; }
+    ti->push_to_read_set_for_stx({wso->get_storage(), rec_ptr, read_tid});
+    if (rs != Status::OK) { return rs; }
+    wso->resolve_rmw(current);
+    return Status::OK;
+}
 
-    // index access
-    Record* rec_ptr{};
-    std::pair<yakushima::node_version64_body, yakushima::node_version64*>
-            checked_version{};
-    rc = get<Record>(storage, key, rec_ptr, &checked_version);
-    if (rc != Status::OK) {
-        // read protection for concurrent occ
-        auto rc_ns = ti->get_node_set().emplace_back(checked_version);
-        if (rc_ns == Status::ERR_CC) {
-            short_tx::abort(ti);
-            std::unique_lock<std::mutex> lk{ti->get_mtx_result_info()};
-            ti->get_result_info().set_storage_name(storage);
-            ti->set_result(reason_code::CC_OCC_PHANTOM_AVOIDANCE);
-            return Status::ERR_CC;
-        }
+/**
+ * @brief register the read of non-existence of the key.
+ * @param[in,out] rrbs The range read by short info of @a storage. If it is
+ * nullptr, it is found and registered, and it is set.
+ * @return Status::OK success.
+ * @return Status::ERR_CC this transaction was aborted by phantom avoidance.
+ */
+static Status register_not_found(
+        session* const ti, Storage const storage,
+        std::pair<yakushima::node_version64_body,
+                  yakushima::node_version64*> const& checked_version,
+        range_read_by_short*& rrbs) {
+    // read protection for concurrent occ
+    auto rc_ns = ti->get_node_set().emplace_back(checked_version);
+    if (rc_ns == Status::ERR_CC) {
+        short_tx::abort(ti);
+        std::unique_lock<std::mutex> lk{ti->get_mtx_result_info()};
+        ti->get_result_info().set_storage_name(storage);
+        ti->set_result(reason_code::CC_OCC_PHANTOM_AVOIDANCE);
+        return Status::ERR_CC;
+    }
 
-        // read protection for low priori ltx
+    // read protection for low priori ltx
+    if (rrbs == nullptr) {
         wp::page_set_meta* psm{};
         auto rc_fpsm{wp::find_page_set_meta(storage, psm)};
         if (rc_fpsm == Status::WARN_NOT_FOUND) {
             LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path";
             return Status::ERR_FATAL;
         }
-        range_read_by_short* rrbs{psm->get_range_read_by_short_ptr()};
+        rrbs = psm->get_range_read_by_short_ptr();
         ti->push_to_range_read_by_short_set(rrbs);
-        return rc;
     }
+    return Status::OK;
+}
 
+/**
+ * @brief read the record found in the index.
+ */
+static Status read_found_record(session* const ti, Storage const storage,
+                                Record* const rec_ptr, std::string& value,
+                                bool const read_value) {
     // check local write set
     write_set_obj* in_ws{ti->get_write_set().search(rec_ptr)}; // NOLINT
     if (in_ws != nullptr) {
@@ -74,6 +112,10 @@ Status search_key(session* ti, Storage const storage,
             return Status::WARN_NOT_FOUND;
         }
         if (read_value) {
+            if (in_ws->get_rmw() == write_set_obj::rmw_kind::MERGE) {
+                auto rc = resolve_merge_by_read(ti, in_ws);
+                if (rc != Status::OK) { return rc; }
+            }
             std::shared_lock<std::shared_mutex> lk{rec_ptr->get_mtx_value()};
             in_ws->get_value(value);
         }
@@ -87,12 +129,108 @@ Status search_key(session* ti, Storage const storage,
     // it didn't read by others lock.
     if (rs == Status::WARN_CONCURRENT_UPDATE) { return rs; }
     // it did tx read.
-    if (rc == Status::OK) {
-        // it read normal page
-        if (read_value) { value = read_res; }
-    }
+    if (read_value) { value = read_res; }
     ti->push_to_read_set_for_stx({storage, rec_ptr, read_tid});
     return rs;
 }
 
+Status search_key(session* ti, Storage const storage,
+                  std::string_view const key, std::string& value,
+                  bool const read_value) {
+    // check wp
+    auto rc{wp_verify(ti, storage, key, key)};
+    if (rc != Status::OK) { return rc; }
+
+    // check reads so far
+    rc = early_read_verify(ti);
+    if (rc != Status::OK) { return rc; }
+
+    // index access
+    Record* rec_ptr{};
+    std::pair<yakushima::node_version64_body, yakushima::node_version64*>
+            checked_version{};
+    rc = get<Record>(storage, key, rec_ptr, &checked_version);
+    if (rc != Status::OK) {
+        range_read_by_short* rrbs{};
+        auto rc_nf = register_not_found(ti, storage, checked_version, rrbs);
+        if (rc_nf != Status::OK) { return rc_nf; }
+        return rc;
+    }
+
+    return read_found_record(ti, storage, rec_ptr, value, read_value);
+}
+
+Status search_key_batch(session* const ti, Storage const storage,
+                        std::string_view const* const keys,
+                        std::string* const values, Status* const statuses,
+                        std::size_t const size) {
+    // find the wp info once for the batch
+    wp::wp_meta* wm{};
+    auto rc{wp::find_wp_meta(storage, wm)};
+    if (rc != Status::OK) {
+        std::fill(statuses, statuses + size, // NOLINT
+                  Status::WARN_STORAGE_NOT_FOUND);
+        return Status::WARN_STORAGE_NOT_FOUND;
+    }
+    auto wps{wm->get_wped()};
+    bool const wped{wp::wp_meta::find_min_ep(wps) != 0};
+
+    // check reads so far
+    rc = early_read_verify(ti);
+    if (rc != Status::OK) { return rc; }
+
+    /**
+     * It probes the index for a group of keys and prefetches the found
+     * records, then reads them. So the cache misses on the records of the
+     * group overlap each other.
+     */
+    constexpr std::size_t group_size{16};
+    std::array<Record*, group_size> rec_ptrs{};
+    std::array<std::pair<yakushima::node_version64_body,
+                         yakushima::node_version64*>,
+               group_size>
+            checked_versions{};
+    range_read_by_short* rrbs{};
+    for (std::size_t begin = 0; begin < size; begin += group_size) {
+        std::size_t const end{std::min(begin + group_size, size)};
+        // check wp for each key of the group
+        for (std::size_t i = begin; wped && i < end; ++i) {
+            auto find_min_ep{wm->find_min_ep_for_key(wps, keys[i])}; // NOLINT
+            if (find_min_ep != 0 &&
+                find_min_ep <= epoch::get_global_epoch()) {
+                statuses[i] = abort_by_wp_verify(ti); // NOLINT
+                return statuses[i];                   // NOLINT
+            }
+        }
+        // index probe
+        for (std::size_t i = begin; i < end; ++i) {
+            auto& rec_ptr = rec_ptrs.at(i - begin);
+            rec_ptr = nullptr;
+            auto& st = statuses[i]; // NOLINT
+            st = check_constraint_key_length(keys[i]); // NOLINT
+            if (st != Status::OK) { continue; }
+            st = get<Record>(storage, keys[i], rec_ptr, // NOLINT
+                             &checked_versions.at(i - begin));
+            if (st == Status::OK) {
+                __builtin_prefetch(rec_ptr, 0, 3); // NOLINT
+            }
+        }
+        // read
+        for (std::size_t i = begin; i < end; ++i) {
+            auto& st = statuses[i]; // NOLINT
+            if (st == Status::WARN_INVALID_KEY_LENGTH) { continue; }
+            if (st == Status::OK) {
+                st = read_found_record(ti, storage, rec_ptrs.at(i - begin),
+                                       values[i], true); // NOLINT
+            } else {
+                auto rc_nf = register_not_found(
+                        ti, storage, checked_versions.at(i - begin), rrbs);
+                if (rc_nf != Status::OK) { st = rc_nf; }
+            }
+            if (st > Status::OK) { return st; }
+        }
+    }
+    return Status::OK;
+}
+
 } // namespace shirakami::short_tx
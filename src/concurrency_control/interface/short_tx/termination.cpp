@@ -18,6 +18,46 @@
 
 namespace shirakami::short_tx {
 
+// ==========
+// prefetch
+/**
+ * @brief loop over the local set with software prefetch.
+ * @details Records are on random heap locations, so commit phases stall on
+ * each record access. It prefetches the record which is
+ * PARAM_COMMIT_PREFETCH_DISTANCE elements ahead of the processing one.
+ * @tparam for_write whether the record is prefetched for write.
+ * @param[in] cont local set.
+ * @param[in] get_rec_ptr it extracts Record* from the element.
+ * @param[in] process it processes the element. If it returns other than
+ * Status::OK, the loop stops and the status is returned.
+ */
+template<bool for_write, class Cont, class GetRecPtr, class Process>
+static inline Status for_each_with_prefetch(Cont& cont, GetRecPtr get_rec_ptr,
+                                            Process process) {
+    [[maybe_unused]] auto prefetch = [&get_rec_ptr](auto& elem) {
+        __builtin_prefetch(get_rec_ptr(elem), for_write ? 1 : 0, 3); // NOLINT
+    };
+    auto ahead = cont.begin();
+#if PARAM_COMMIT_PREFETCH_DISTANCE > 0
+    for (std::size_t i = 0;
+         i < PARAM_COMMIT_PREFETCH_DISTANCE && ahead != cont.end(); ++i) {
+        prefetch(*ahead);
+        ++ahead;
+    }
+#endif
+    for (auto itr = cont.begin(); itr != cont.end(); ++itr) {
+#if PARAM_COMMIT_PREFETCH_DISTANCE > 0
+        if (ahead != cont.end()) {
+            prefetch(*ahead);
+            ++ahead;
+        }
+#endif
+        auto rc = process(*itr);
+        if (rc != Status::OK) { return rc; }
+    }
+    return Status::OK;
+}
+
 // ==========
 // locking
 static void unlock_write_set(session* const ti) {
@@ -214,7 +254,61 @@ static Status read_verify(session* ti, tid_word read_tid, tid_word check,
     return Status::OK;
 }
 
-static Status wp_verify(Storage const st, epoch::epoch_t const commit_epoch) {
+Status early_read_verify(session* const ti, bool const force) {
+    auto const interval = session::optflag_occ_early_read_verify_interval;
+    if (interval == 0) { return Status::OK; } // disabled
+    if (!force) {
+        auto ct = ti->get_ct_op_since_read_verify() + 1;
+        if (ct < interval) {
+            ti->set_ct_op_since_read_verify(ct);
+            return Status::OK;
+        }
+    }
+    ti->set_ct_op_since_read_verify(0);
+
+    Record* failed_rec_ptr{};
+    Storage failed_st{};
+    {
+        std::shared_lock<std::shared_mutex> lk{ti->get_mtx_read_set_for_stx()};
+        for (auto&& itr : ti->get_read_set_for_stx()) {
+            auto* rec_ptr = itr.get_rec_ptr();
+            tid_word check{loadAcquire(rec_ptr->get_tidw_ref().get_obj())};
+            while (check.get_lock_by_gc()) {
+                _mm_pause();
+                check.get_obj() =
+                        loadAcquire(rec_ptr->get_tidw_ref().get_obj());
+            }
+            /**
+             * Only the change of the timestamp is checked. Locked record may
+             * be released by aborting owner, so it is left to commit phase.
+             */
+            if (itr.get_tid().get_tid() != check.get_tid() ||
+                itr.get_tid().get_epoch() != check.get_epoch()) {
+                failed_rec_ptr = rec_ptr;
+                failed_st = itr.get_storage();
+                break;
+            }
+        }
+    }
+    if (failed_rec_ptr == nullptr) { return Status::OK; }
+
+    // doomed, abort early
+    std::unique_lock<std::mutex> lk{ti->get_mtx_result_info()};
+    ti->get_result_info().set_key_storage_name(failed_rec_ptr->get_key_view(),
+                                               failed_st);
+    ti->set_result(reason_code::CC_OCC_READ_VERIFY);
+    short_tx::abort(ti);
+    return Status::ERR_CC;
+}
+
+/**
+ * @brief verify wp for the records read from the storage.
+ * @param[in] begin the first of the read records of the storage.
+ * @param[in] end the end of the read records of the storage.
+ */
+template<class Itr>
+static Status wp_verify(Storage const st, epoch::epoch_t const commit_epoch,
+                        Itr const begin, Itr const end) {
     wp::wp_meta* wm{};
     auto rc{find_wp_meta(st, wm)};
     if (rc != Status::OK) {
@@ -225,8 +319,14 @@ static Status wp_verify(Storage const st, epoch::epoch_t const commit_epoch) {
     }
     auto wps{wm->get_wped()};
     auto find_min_ep{wp::wp_meta::find_min_ep(wps)};
-    if (find_min_ep != 0 && find_min_ep <= commit_epoch) {
-        return Status::ERR_CC;
+    if (find_min_ep == 0 || find_min_ep > commit_epoch) { return Status::OK; }
+    // some wp exists, check whether it covers the keys
+    for (auto itr = begin; itr != end; ++itr) {
+        find_min_ep = wm->find_min_ep_for_key(
+                wps, std::get<1>(*itr)->get_key_view());
+        if (find_min_ep != 0 && find_min_ep <= commit_epoch) {
+            return Status::ERR_CC;
+        }
     }
     return Status::OK;
 }
@@ -234,55 +334,111 @@ static Status wp_verify(Storage const st, epoch::epoch_t const commit_epoch) {
 static Status read_wp_verify(session* const ti, epoch::epoch_t ce,
                              tid_word& commit_tid) {
     tid_word check{};
-    std::vector<Storage> accessed_st{};
+    std::vector<std::pair<Storage, Record*>> accessed{};
     // read verify
-    for (auto&& itr : ti->get_read_set_for_stx()) {
-        auto* rec_ptr = itr.get_rec_ptr();
-        check.get_obj() = loadAcquire(rec_ptr->get_tidw_ref().get_obj());
-
-        while (check.get_lock_by_gc()) {
-            // gc takes locks equal or less than one lock.
-            _mm_pause();
-            check.get_obj() = loadAcquire(rec_ptr->get_tidw_ref().get_obj());
-        }
+    auto rc = for_each_with_prefetch<false>(
+            ti->get_read_set_for_stx(),
+            [](read_set_obj& rso) { return rso.get_rec_ptr(); },
+            [ti, &check, &accessed, &commit_tid](read_set_obj& itr) {
+                auto* rec_ptr = itr.get_rec_ptr();
+                check.get_obj() =
+                        loadAcquire(rec_ptr->get_tidw_ref().get_obj());
+
+                while (check.get_lock_by_gc()) {
+                    // gc takes locks equal or less than one lock.
+                    _mm_pause();
+                    check.get_obj() =
+                            loadAcquire(rec_ptr->get_tidw_ref().get_obj());
+                }
 
-        // verify
-        // ==============================
-        if (read_verify(ti, itr.get_tid(), check, rec_ptr, itr.get_storage()) != Status::OK) {
-            unlock_write_set(ti);
-            std::unique_lock<std::mutex> lk{ti->get_mtx_result_info()};
-            ti->get_result_info().set_key_storage_name(rec_ptr->get_key_view(),
-                                                       itr.get_storage());
-            ti->set_result(reason_code::CC_OCC_READ_VERIFY);
-            short_tx::abort(ti);
-            return Status::ERR_CC;
-        }
-        // ==============================
+                // verify
+                // ==============================
+                if (read_verify(ti, itr.get_tid(), check, rec_ptr,
+                                itr.get_storage()) != Status::OK) {
+                    unlock_write_set(ti);
+                    std::unique_lock<std::mutex> lk{ti->get_mtx_result_info()};
+                    ti->get_result_info().set_key_storage_name(
+                            rec_ptr->get_key_view(), itr.get_storage());
+                    ti->set_result(reason_code::CC_OCC_READ_VERIFY);
+                    short_tx::abort(ti);
+                    return Status::ERR_CC;
+                }
+                // ==============================
 
-        // log accessed storage
-        accessed_st.emplace_back(itr.get_storage());
+                // log accessed storage and key
+                accessed.emplace_back(itr.get_storage(), rec_ptr);
 
-        // compute timestamp
-        commit_tid = std::max(check, commit_tid);
-    }
+                // compute timestamp
+                commit_tid = std::max(check, commit_tid);
+                return Status::OK;
+            });
+    if (rc != Status::OK) { return rc; }
 
     // wp verify
-    // reduce redundat
-    std::sort(accessed_st.begin(), accessed_st.end());
-    accessed_st.erase(std::unique(accessed_st.begin(), accessed_st.end()),
-                      accessed_st.end());
-    for (auto&& each_st : accessed_st) {
-        if (wp_verify(each_st, ce) != Status::OK) {
+    // group by storage
+    std::stable_sort(accessed.begin(), accessed.end(),
+                     [](auto const& a, auto const& b) {
+                         return a.first < b.first;
+                     });
+    for (auto itr = accessed.begin(); itr != accessed.end();) {
+        auto end = std::find_if(itr, accessed.end(), [itr](auto const& e) {
+            return e.first != itr->first;
+        });
+        if (wp_verify(itr->first, ce, itr, end) != Status::OK) {
             unlock_write_set(ti);
             short_tx::abort(ti);
             ti->set_result(reason_code::CC_OCC_WP_VERIFY);
             return Status::ERR_CC;
         }
+        itr = end;
     }
 
     return Status::OK;
 }
 
+/**
+ * @brief verify wp for the records which merge and update_if read at commit.
+ * @details The value of them is computed from the current value, so the ltx
+ * which preserves the key and is before this tx invalidates the value like a
+ * read.
+ */
+static Status rmw_wp_verify(session* const ti, epoch::epoch_t const ce,
+                            std::vector<std::pair<Storage, Record*>>& targets) {
+    // group by storage
+    std::stable_sort(targets.begin(), targets.end(),
+                     [](auto const& a, auto const& b) {
+                         return a.first < b.first;
+                     });
+    for (auto itr = targets.begin(); itr != targets.end();) {
+        auto end = std::find_if(itr, targets.end(), [itr](auto const& e) {
+            return e.first != itr->first;
+        });
+        if (wp_verify(itr->first, ce, itr, end) != Status::OK) {
+            ti->set_result(reason_code::CC_OCC_WP_VERIFY);
+            return Status::ERR_CC;
+        }
+        itr = end;
+    }
+    return Status::OK;
+}
+
+/**
+ * @brief lock the record by the occ lock contention policy.
+ * @return true it acquired the lock.
+ * @return false it gave up.
+ */
+static bool lock_record_at_write_lock(Record* const rec_ptr) {
+    return rec_ptr->get_tidw_ref().lock(
+            session::optflag_occ_lock_contention_policy,
+            session::optflag_occ_lock_spin_bound);
+}
+
+/**
+ * @return Status::OK success and the record is locked.
+ * @return Status::ERR_CC fail and the record is locked.
+ * @return Status::WARN_CONCURRENT_UPDATE it gave up locking by the lock
+ * contention policy. The record is not locked.
+ */
 static Status sert_process_at_write_lock(write_set_obj* wso) {
     // check key exists yet
     std::string key{};
@@ -313,7 +469,9 @@ static Status sert_process_at_write_lock(write_set_obj* wso) {
 
     RE_LOCK: // NOLINT
         // locking
-        rec_ptr->get_tidw_ref().lock();
+        if (!lock_record_at_write_lock(rec_ptr)) {
+            return Status::WARN_CONCURRENT_UPDATE;
+        }
 
         /**
          * recheck hooked yet. maybe unhooked between checking hooking and lock
@@ -360,12 +518,19 @@ static Status sert_process_at_write_lock(write_set_obj* wso) {
     return Status::ERR_CC; // for fail safe
 }
 
-static Status write_lock(session* ti, tid_word& commit_tid) {
+/**
+ * @brief lock the records of the write set.
+ * @param[out] rmw_targets the records which merge and update_if read under
+ * the lock.
+ */
+static Status write_lock(session* ti, tid_word& commit_tid,
+                         std::vector<std::pair<Storage, Record*>>& rmw_targets) {
     std::size_t num_locked{0};
     // sorf if occ for deadlock avoidance
     ti->get_write_set().sort_if_ol();
 
-    auto process = [ti, &commit_tid, &num_locked](write_set_obj* wso_ptr) {
+    auto process = [ti, &commit_tid, &num_locked,
+                    &rmw_targets](write_set_obj* wso_ptr) {
         auto* rec_ptr{wso_ptr->get_rec_ptr()};
         auto abort_process = [ti, &num_locked]() {
             if (num_locked > 0) { unlock_records(ti, num_locked); }
@@ -375,6 +540,18 @@ static Status write_lock(session* ti, tid_word& commit_tid) {
             wso_ptr->get_op() == OP_TYPE::UPSERT) {
             // about sert common process
             auto rc = sert_process_at_write_lock(wso_ptr);
+            if (rc == Status::WARN_CONCURRENT_UPDATE) {
+                // gave up locking
+                {
+                    std::unique_lock<std::mutex> lk{
+                            ti->get_mtx_result_info()};
+                    ti->get_result_info().set_key_storage_name(
+                            rec_ptr->get_key_view(), wso_ptr->get_storage());
+                    ti->set_result(reason_code::CC_OCC_WRITE_LOCK_CONTENTION);
+                }
+                abort_process();
+                return Status::ERR_CC;
+            }
             ++num_locked;
             /**
              * NOTE: sert_process_at_write_lock must have locked the record
@@ -418,7 +595,18 @@ static Status write_lock(session* ti, tid_word& commit_tid) {
             }
 
             // lock the record
-            rec_ptr->get_tidw_ref().lock();
+            if (!lock_record_at_write_lock(rec_ptr)) {
+                // gave up locking
+                {
+                    std::unique_lock<std::mutex> lk{
+                            ti->get_mtx_result_info()};
+                    ti->get_result_info().set_key_storage_name(
+                            rec_ptr->get_key_view(), wso_ptr->get_storage());
+                    ti->set_result(reason_code::CC_OCC_WRITE_LOCK_CONTENTION);
+                }
+                abort_process();
+                return Status::ERR_CC;
+            }
 
             // detail info
             if (logging::get_enable_logging_detail_info()) {
@@ -441,6 +629,26 @@ static Status write_lock(session* ti, tid_word& commit_tid) {
                         rec_ptr->get_key_view(), wso_ptr->get_storage());
                 return Status::ERR_KVS;
             }
+
+            // fix the value of read-modify-write under the lock
+            if (wso_ptr->get_rmw() != write_set_obj::rmw_kind::NONE) {
+                std::string current{};
+                rec_ptr->get_value(current);
+                if (!wso_ptr->resolve_rmw(current)) {
+                    {
+                        std::unique_lock<std::mutex> lk{
+                                ti->get_mtx_result_info()};
+                        ti->get_result_info().set_key_storage_name(
+                                rec_ptr->get_key_view(),
+                                wso_ptr->get_storage());
+                        ti->set_result(reason_code::KVS_UPDATE_IF_MISMATCH);
+                    }
+                    abort_process();
+                    return Status::ERR_KVS;
+                }
+                // it is an implicit read
+                rmw_targets.emplace_back(wso_ptr->get_storage(), rec_ptr);
+            }
         } else {
             LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path";
             return Status::ERR_FATAL;
@@ -451,24 +659,28 @@ static Status write_lock(session* ti, tid_word& commit_tid) {
     {
         std::shared_lock<std::shared_mutex> lk{ti->get_write_set().get_mtx()};
         if (ti->get_write_set().get_for_batch()) {
-            for (auto&& itr : ti->get_write_set().get_ref_cont_for_bt()) {
-                auto rc = process(&itr.second);
-                if (rc != Status::OK) { return rc; }
-            }
-        } else {
-            for (auto&& itr : ti->get_write_set().get_ref_cont_for_occ()) {
-                auto rc = process(&itr);
-                if (rc != Status::OK) { return rc; }
-            }
+            return for_each_with_prefetch<true>(
+                    ti->get_write_set().get_ref_cont_for_bt(),
+                    [](auto& elem) { return elem.first; },
+                    [&process](auto& elem) { return process(&elem.second); });
         }
+        return for_each_with_prefetch<true>(
+                ti->get_write_set().get_ref_cont_for_occ(),
+                [](write_set_obj& wso) { return wso.get_rec_ptr(); },
+                [&process](write_set_obj& wso) { return process(&wso); });
     }
-
-    return Status::OK;
 }
 
-static Status write_phase(session* ti, epoch::epoch_t ce) {
+/**
+ * @param[in] log_owner the session whose local wal buffer takes the log
+ * records of this tx.
+ */
+static Status write_phase(session* ti, epoch::epoch_t ce,
+                          [[maybe_unused]] session* const log_owner) {
     std::unordered_set<Storage> dirty{};
-    auto process = [ti, ce, &dirty](write_set_obj* wso_ptr) {
+    [[maybe_unused]] wp::durability_cache durability{};
+    auto process = [ti, ce, log_owner, &dirty,
+                    &durability](write_set_obj* wso_ptr) {
         tid_word update_tid{ti->get_mrc_tid()};
         VLOG(log_trace) << "write. op type: " << wso_ptr->get_op() << ", key: \""
                         << binary_printer(wso_ptr->get_rec_ptr()->get_key_view())
@@ -495,9 +707,8 @@ static Status write_phase(session* ti, epoch::epoch_t ce) {
                     // DELETE'd Record (not-absent -> deleted) has non-zero epoch/tid
                     old_tid.get_epoch() == 0 && old_tid.get_tid() == 0) {
                     // set value
-                    std::string vb{};
-                    wso_ptr->get_value(vb);
-                    wso_ptr->get_rec_ptr()->set_value(vb);
+                    wso_ptr->get_rec_ptr()->set_value(
+                            wso_ptr->get_value_view());
 
                     // set timestamp and unlock
                     wso_ptr->get_rec_ptr()->set_tid(update_tid);
@@ -526,9 +737,9 @@ static Status write_phase(session* ti, epoch::epoch_t ce) {
                     Record* rec_ptr{wso_ptr->get_rec_ptr()};
                     // append new version
                     // gen new version
-                    std::string vb{};
+                    std::string_view vb{};
                     if (wso_ptr->get_op() != OP_TYPE::DELETE) {
-                        wso_ptr->get_value(vb);
+                        vb = wso_ptr->get_value_view();
                     }
                     version* new_v{
                             new version(update_tid, vb, rec_ptr->get_latest())};
@@ -544,9 +755,8 @@ static Status write_phase(session* ti, epoch::epoch_t ce) {
                 } else {
                     // update existing version
                     if (wso_ptr->get_op() != OP_TYPE::DELETE) {
-                        std::string vb{};
-                        wso_ptr->get_value(vb);
-                        wso_ptr->get_rec_ptr()->set_value(vb);
+                        wso_ptr->get_rec_ptr()->set_value(
+                                wso_ptr->get_value_view());
                     }
                 }
                 // detail info
@@ -575,11 +785,15 @@ static Status write_phase(session* ti, epoch::epoch_t ce) {
             }
         }
 #ifdef PWAL
+        // the writes to non-durable storage are not logged
+        if (!durability.is_durable(wso_ptr->get_storage())) {
+            return Status::OK;
+        }
         // add log records to local wal buffer
         std::string key{};
         wso_ptr->get_rec_ptr()->get_key(key);
-        std::string val{};
-        wso_ptr->get_value(val);
+        // the value is no longer needed by the write set, so take it over.
+        std::string val{wso_ptr->release_value()};
         log_operation lo{};
         switch (wso_ptr->get_op()) {
             case OP_TYPE::INSERT: {
@@ -617,38 +831,39 @@ static Status write_phase(session* ti, epoch::epoch_t ce) {
             minor_version <<= 63; // NOLINT
             minor_version |= update_tid.get_tid();
         }
-        ti->get_lpwal_handle().push_log(shirakami::lpwal::log_record(
+        log_owner->get_lpwal_handle().push_log(shirakami::lpwal::log_record(
                 lo,
                 lpwal::write_version_type(update_tid.get_epoch(),
                                           minor_version),
-                wso_ptr->get_storage(), key, val, wso_ptr->get_lobs()));
+                wso_ptr->get_storage(), std::move(key), std::move(val),
+                wso_ptr->get_lobs()));
 #endif
         return Status::OK;
     };
 
     {
 #ifdef PWAL
-        std::unique_lock<std::mutex> lk0{ti->get_lpwal_handle().get_mtx_logs()};
+        std::unique_lock<std::mutex> lk0{
+                log_owner->get_lpwal_handle().get_mtx_logs()};
 #endif
         std::shared_lock<std::shared_mutex> lk{ti->get_write_set().get_mtx()};
+        Status rc{};
         if (ti->get_write_set().get_for_batch()) {
-            for (auto&& itr : ti->get_write_set().get_ref_cont_for_bt()) {
-                auto rc = process(&itr.second);
-                if (rc == Status::OK) { continue; }
-                if (rc == Status::ERR_FATAL) { return Status::ERR_FATAL; }
-                LOG_FIRST_N(ERROR, 1)
-                        << log_location_prefix << "impossible code path.";
-                return Status::ERR_FATAL;
-            }
+            rc = for_each_with_prefetch<true>(
+                    ti->get_write_set().get_ref_cont_for_bt(),
+                    [](auto& elem) { return elem.first; },
+                    [&process](auto& elem) { return process(&elem.second); });
         } else {
-            for (auto&& itr : ti->get_write_set().get_ref_cont_for_occ()) {
-                auto rc = process(&itr);
-                if (rc == Status::OK) { continue; }
-                if (rc == Status::ERR_FATAL) { return Status::ERR_FATAL; }
-                LOG_FIRST_N(ERROR, 1)
-                        << log_location_prefix << "impossible code path.";
-                return Status::ERR_FATAL;
-            }
+            rc = for_each_with_prefetch<true>(
+                    ti->get_write_set().get_ref_cont_for_occ(),
+                    [](write_set_obj& wso) { return wso.get_rec_ptr(); },
+                    [&process](write_set_obj& wso) { return process(&wso); });
+        }
+        if (rc != Status::OK) {
+            if (rc == Status::ERR_FATAL) { return Status::ERR_FATAL; }
+            LOG_FIRST_N(ERROR, 1)
+                    << log_location_prefix << "impossible code path.";
+            return Status::ERR_FATAL;
         }
     }
     garbage::set_dirty(dirty);
@@ -692,6 +907,17 @@ static void register_point_read_by_short(session* const ti) {
     }
 }
 
+static void register_rmw_read_by_short(
+        session* const ti,
+        std::vector<std::pair<Storage, Record*>> const& targets) {
+    auto ce{ti->get_mrc_tid().get_epoch()};
+
+    for (auto&& itr : targets) {
+        auto& ro{itr.second->get_read_by()};
+        ro.push(ce);
+    }
+}
+
 static void register_range_read_by_short(session* const ti) {
     auto ce{ti->get_mrc_tid().get_epoch()};
 
@@ -717,69 +943,130 @@ static void process_tx_state(session* ti,
     }
 }
 
-extern Status commit(session* const ti) {
+/**
+ * @brief check whether the transaction has read nothing.
+ * @details Such a transaction has nothing to verify and register about read
+ * at commit phase.
+ */
+static bool is_write_only(session* const ti) {
+    if (!ti->get_node_set().empty()) { return false; }
+    {
+        std::shared_lock<std::shared_mutex> lk{
+                ti->get_mtx_range_read_by_short_set()};
+        if (!ti->get_range_read_by_short_set().empty()) { return false; }
+    }
+    std::shared_lock<std::shared_mutex> lk{ti->get_mtx_read_set_for_stx()};
+    return ti->get_read_set_for_stx().empty();
+}
+
+/**
+ * @param[in] batch_leader the first tx of the batch if this is committed by
+ * commit_batch(), otherwise nullptr. Its short expose lock is held by the
+ * caller and its local wal buffer takes the log records of this tx.
+ */
+static Status commit_without_flush_log(session* const ti,
+                                       session* const batch_leader) {
     auto abort_and_call_ccb = [ti](Status rc) {
         short_tx::abort(ti);
         ti->call_commit_callback(rc, ti->get_result_info().get_reason_code(),
                                  0);
     };
 
-    // write lock phase
+    /**
+     * Select the commit path by the shape of local sets.
+     * read only: it doesn't need write lock, short expose lock and write
+     * phase.
+     * write only: it doesn't need read verify, node verify and read by
+     * registration.
+     */
+    bool const read_only{ti->get_write_set().empty() &&
+                         ti->sequence_set().set().empty()};
+    bool const write_only{!read_only && is_write_only(ti)};
+    bool const lock_expose{!read_only && batch_leader == nullptr};
+    session* const log_owner{batch_leader == nullptr ? ti : batch_leader};
+    auto unlock_short_expose_ongoing_if_locked = [ti, lock_expose]() {
+        if (lock_expose) { ti->unlock_short_expose_ongoing_and_refresh_epoch(); }
+    };
+
     tid_word commit_tid{};
-    auto rc{write_lock(ti, commit_tid)};
-    if (rc != Status::OK) {
-        abort_and_call_ccb(rc);
-        return rc;
-    }
+    std::vector<std::pair<Storage, Record*>> rmw_targets{};
+    Status rc{};
+    if (!read_only) {
+        // write lock phase
+        rc = write_lock(ti, commit_tid, rmw_targets);
+        if (rc != Status::OK) {
+            abort_and_call_ccb(rc);
+            return rc;
+        }
 
-    // lock before get global epoch (for Record epoch)
-    ti->lock_short_expose_ongoing();
+        // lock before get global epoch (for Record epoch)
+        if (lock_expose) { ti->lock_short_expose_ongoing(); }
+    }
 
     epoch::epoch_t ce{epoch::get_global_epoch()};
 
-    // read wp verify
-    rc = read_wp_verify(ti, ce, commit_tid);
-    if (rc != Status::OK) {
-        unlock_write_set(ti);
-        ti->unlock_short_expose_ongoing_and_refresh_epoch();
-        abort_and_call_ccb(rc);
-        return rc;
+    if (!rmw_targets.empty()) {
+        // merge and update_if read the records at write lock
+        rc = rmw_wp_verify(ti, ce, rmw_targets);
+        if (rc != Status::OK) {
+            unlock_write_set(ti);
+            unlock_short_expose_ongoing_if_locked();
+            abort_and_call_ccb(rc);
+            return rc;
+        }
     }
 
-    // node verify
-    rc = ti->get_node_set().node_verify();
-    if (rc != Status::OK) {
-        unlock_write_set(ti);
-        ti->set_result(reason_code::CC_OCC_PHANTOM_AVOIDANCE);
-        ti->unlock_short_expose_ongoing_and_refresh_epoch();
-        abort_and_call_ccb(rc);
-        return rc;
+    if (!write_only) {
+        // read wp verify
+        rc = read_wp_verify(ti, ce, commit_tid);
+        if (rc != Status::OK) {
+            unlock_write_set(ti);
+            unlock_short_expose_ongoing_if_locked();
+            abort_and_call_ccb(rc);
+            return rc;
+        }
+
+        // node verify
+        rc = ti->get_node_set().node_verify();
+        if (rc != Status::OK) {
+            unlock_write_set(ti);
+            ti->set_result(reason_code::CC_OCC_PHANTOM_AVOIDANCE);
+            unlock_short_expose_ongoing_if_locked();
+            abort_and_call_ccb(rc);
+            return rc;
+        }
     }
 
     compute_commit_tid(ti, ce, commit_tid);
 
-    // write phase
-    rc = write_phase(ti, ce);
-    if (rc != Status::OK) {
-        ti->unlock_short_expose_ongoing_and_refresh_epoch();
-        if (rc == Status::ERR_FATAL) { return Status::ERR_FATAL; }
-        LOG_FIRST_N(ERROR, 1) << log_location_prefix << "impossible code path.";
-        return Status::ERR_FATAL;
+    if (!read_only) {
+        // write phase
+        rc = write_phase(ti, ce, log_owner);
+        if (rc != Status::OK) {
+            unlock_short_expose_ongoing_if_locked();
+            if (rc == Status::ERR_FATAL) { return Status::ERR_FATAL; }
+            LOG_FIRST_N(ERROR, 1)
+                    << log_location_prefix << "impossible code path.";
+            return Status::ERR_FATAL;
+        }
     }
 
-    // This calculation can be done outside the critical section.
-    register_point_read_by_short(ti);
-    register_range_read_by_short(ti);
+    if (!write_only) {
+        // This calculation can be done outside the critical section.
+        register_point_read_by_short(ti);
+        register_range_read_by_short(ti);
+    }
+    register_rmw_read_by_short(ti, rmw_targets);
 
     // sequence process
     // This must be after cc commit and before log process
     ti->commit_sequence(ti->get_mrc_tid());
-    ti->unlock_short_expose_ongoing_and_refresh_epoch();
+    unlock_short_expose_ongoing_if_locked();
 
     auto this_dm = epoch::get_global_epoch();
 #if defined(PWAL)
     {
-        auto& handle = ti->get_lpwal_handle();
+        auto& handle = log_owner->get_lpwal_handle();
         std::unique_lock lk{handle.get_mtx_logs()};
         if (handle.get_begun_session()) { this_dm = handle.get_durable_epoch(); }
     }
@@ -794,9 +1081,12 @@ extern Status commit(session* const ti) {
     // set transaction result
     ti->set_result(reason_code::UNKNOWN);
 
-    ti->call_commit_callback(rc, {}, this_dm);
+    ti->call_commit_callback(Status::OK, {}, this_dm);
 
-    // flush log if need
+    return Status::OK;
+}
+
+void flush_log_if_needed([[maybe_unused]] session* const ti) {
 #if defined(PWAL)
     auto oldest_log_epoch{ti->get_lpwal_handle().get_min_log_epoch()};
     // think the wal buffer is empty due to background thread's work
@@ -807,8 +1097,35 @@ extern Status commit(session* const ti) {
         shirakami::lpwal::flush_log(static_cast<void*>(ti));
     }
 #endif
+}
+
+extern Status commit(session* const ti) {
+    auto rc = commit_without_flush_log(ti, nullptr);
+    if (rc != Status::OK) { return rc; }
+
+    // flush log if need
+    flush_log_if_needed(ti);
 
     return Status::OK;
 }
 
+extern void commit_batch(std::vector<session*> const& tis,
+                         std::vector<Status>& results) {
+    results.clear();
+    if (tis.empty()) { return; }
+    results.reserve(tis.size());
+
+    // the lock of the leader covers the exposure of all the batch
+    auto* const leader{tis.front()};
+    leader->lock_short_expose_ongoing();
+    for (auto* ti : tis) {
+        results.emplace_back(commit_without_flush_log(ti, leader));
+    }
+    leader->unlock_short_expose_ongoing_and_refresh_epoch();
+
+    // the leader has the log records of all the batch. the others may have
+    // the ones of sequence.
+    for (auto* ti : tis) { flush_log_if_needed(ti); }
+}
+
 } // namespace shirakami::short_tx
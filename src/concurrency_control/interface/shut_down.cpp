@@ -12,8 +12,11 @@
 
 #include "concurrency_control/bg_work/include/bg_commit.h"
 #include "concurrency_control/include/epoch_internal.h"
+#include "concurrency_control/include/footprint.h"
+#include "concurrency_control/include/promotion.h"
 #include "concurrency_control/include/read_plan.h"
 #include "concurrency_control/include/session.h"
+#include "concurrency_control/include/shared_snapshot.h"
 #include "concurrency_control/include/wp.h"
 #include "concurrency_control/interface/long_tx/include/long_tx.h"
 #include "concurrency_control/interface/read_only_tx/include/read_only_tx.h"
@@ -131,14 +134,21 @@ static void fin_body([[maybe_unused]] bool force_shut_down_logging) try {
     yakushima::fin();
     VLOG(log_debug_timing_event) << log_location_prefix_timing_event << "shutdown:end_shutdown_yakushima";
 
-    //// about thread pool
-    //VLOG(log_debug_timing_event) << log_location_prefix_timing_event << "shutdown:start_shutdown_thread_pool";
-    //thread_pool::fin();
-    //VLOG(log_debug_timing_event) << log_location_prefix_timing_event << "shutdown:end_shutdown_thread_pool";
+    // about thread pool
+    VLOG(log_debug_timing_event) << log_location_prefix_timing_event << "shutdown:start_shutdown_thread_pool";
+    thread_pool::fin();
+    VLOG(log_debug_timing_event) << log_location_prefix_timing_event << "shutdown:end_shutdown_thread_pool";
 
     // about read area
     read_plan::fin();
 
+    // about shared snapshot
+    shared_snapshot::fin();
+
+    // about promotion
+    promotion::fin();
+    footprint::fin();
+
     // set flag
     set_is_shutdowning(false);
 
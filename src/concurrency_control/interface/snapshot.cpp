@@ -0,0 +1,31 @@
+
+#include "shirakami/api_snapshot.h"
+
+#include "concurrency_control/include/shared_snapshot.h"
+#include "concurrency_control/interface/read_only_tx/include/read_only_tx.h"
+#include "database/include/logging.h"
+
+#include "shirakami/logging.h"
+
+#include "glog/logging.h"
+
+namespace shirakami {
+
+Status open_snapshot(SnapshotHandle& handle) {
+    shirakami_log_entry << "open_snapshot";
+    shared_snapshot* ss{};
+    auto ret = read_only_tx::open_snapshot(ss);
+    handle = static_cast<SnapshotHandle>(ss);
+    shirakami_log_exit << "open_snapshot, Status: " << ret
+                       << ", handle: " << handle;
+    return ret;
+}
+
+Status close_snapshot(SnapshotHandle const handle) {
+    shirakami_log_entry << "close_snapshot, handle: " << handle;
+    auto ret = shared_snapshot::close(static_cast<shared_snapshot*>(handle));
+    shirakami_log_exit << "close_snapshot, Status: " << ret;
+    return ret;
+}
+
+} // namespace shirakami
@@ -237,8 +237,8 @@ static Status init_body(const database_options& options, [[maybe_unused]] void*
     // about back ground worker about commit
     bg_work::bg_commit::init(options.get_waiting_resolver_threads());
 
-    //// about thread pool
-    //thread_pool::init();
+    // about thread pool
+    thread_pool::init();
 
     // about read area
     read_plan::init();
@@ -2,8 +2,11 @@
  * @file wp/storage.cpp
  */
 
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
 
+#include "clock.h"
 #include "storage.h"
 
 #include "concurrency_control/include/garbage.h"
@@ -122,7 +125,8 @@ static Status create_storage_body(std::string_view const key, Storage& storage,
         return Status::WARN_ALREADY_EXISTS;
     }
 
-    write_storage_metadata(key, storage, options);
+    // the non-durable storage keeps its options in memory only
+    if (options.durable()) { write_storage_metadata(key, storage, options); }
     return Status::OK;
 }
 
@@ -134,9 +138,11 @@ Status create_storage(std::string_view key, Storage& storage,
     return ret;
 }
 
-static Status delete_storage_body(Storage const storage) {
+static Status delete_storage_body(Storage const storage, bool const async) {
     std::lock_guard<std::shared_mutex> lk{storage::get_mtx_key_handle_map()};
-    auto ret = storage::delete_storage(storage);
+    // the metadata is deleted with the storage
+    bool const durable{wp::is_durable_storage(storage)};
+    auto ret = storage::delete_storage(storage, async);
     if (ret != Status::OK) { return ret; }
     // delete_storage was succeeded
 
@@ -149,18 +155,86 @@ static Status delete_storage_body(Storage const storage) {
             return Status::ERR_FATAL;
         }
 
-        if (!get_is_shutdowning()) { remove_storage_metadata(key, storage); }
+        if (!get_is_shutdowning() && durable) {
+            remove_storage_metadata(key, storage);
+        }
     }
+    storage::merge_operator_map_erase(storage);
     return Status::OK;
 }
 
 Status delete_storage(Storage const storage) {
     shirakami_log_entry << "delete_storage, storage: " << storage;
-    auto ret = delete_storage_body(storage);
+    auto ret = delete_storage_body(storage, false);
     shirakami_log_exit << "delete_storage, Status: " << ret;
     return ret;
 }
 
+Status delete_storage(Storage const storage, bool const async) {
+    shirakami_log_entry << "delete_storage, storage: " << storage
+                        << ", async: " << async;
+    auto ret = delete_storage_body(storage, async);
+    shirakami_log_exit << "delete_storage, Status: " << ret;
+    return ret;
+}
+
+/**
+ * @brief log that all the records of the storage were removed.
+ * @details The write version of the log is the maximum in the current epoch,
+ * so it is larger than that of every removed record without visiting them.
+ * It returns after the epoch passed, so the records written after this have
+ * larger write versions than the log.
+ * @param[in] st the truncated storage.
+ */
+static void log_truncate_storage([[maybe_unused]] Storage const st) {
+#ifdef PWAL
+    Token s{};
+    while (enter(s) != Status::OK) { _mm_pause(); }
+    auto* ti = static_cast<session*>(s);
+
+    // lock before get global epoch (for Record epoch)
+    ti->lock_short_expose_ongoing();
+    auto ce = epoch::get_global_epoch();
+    /**
+     * The log of remove storage makes the datastore drop the entries of the
+     * storage older than the write version, and the storage id is still
+     * available after that, so it is also used for truncation.
+     */
+    lpwal::write_version_type wv{
+            ce, std::numeric_limits<
+                        lpwal::write_version_type::minor_write_version_type>::
+                        max()};
+    {
+        std::unique_lock<std::mutex> lk{ti->get_lpwal_handle().get_mtx_logs()};
+        ti->get_lpwal_handle().push_log(lpwal::log_record(
+                log_operation::REMOVE_STORAGE, wv, st, {}, {}, {}));
+    }
+    ti->unlock_short_expose_ongoing_and_refresh_epoch();
+
+    leave(s);
+    while (epoch::get_global_epoch() <= ce) {
+        sleepUs(epoch::get_global_epoch_time_us());
+    }
+#endif
+}
+
+static Status truncate_storage_body(Storage const storage) {
+    // block delete_storage against the storage
+    std::shared_lock<std::shared_mutex> lk{storage::get_mtx_key_handle_map()};
+    bool const durable{wp::is_durable_storage(storage)};
+    auto ret = storage::truncate_storage(storage);
+    if (ret != Status::OK) { return ret; }
+    if (durable) { log_truncate_storage(storage); }
+    return Status::OK;
+}
+
+Status truncate_storage(Storage const storage) {
+    shirakami_log_entry << "truncate_storage, storage: " << storage;
+    auto ret = truncate_storage_body(storage);
+    shirakami_log_exit << "truncate_storage, Status: " << ret;
+    return ret;
+}
+
 static Status get_storage_body(std::string_view const key, Storage& out) {
     auto ret = check_constraint_key_length(key);
     if (ret != Status::OK) { return ret; }
@@ -194,6 +268,13 @@ static Status storage_get_options_body(Storage storage, storage_option& options)
         // storage not found
         return ret;
     } // storage found
+    wp::page_set_meta* psm{};
+    if (wp::find_page_set_meta(storage, psm) == Status::OK &&
+        !psm->get_durable()) {
+        // the non-durable storage keeps its options in memory only
+        options = psm->get_storage_option();
+        return Status::OK;
+    }
     Token s{};
     while (enter(s) != Status::OK) { _mm_pause(); }
     std::string value{};
@@ -255,6 +336,13 @@ static Status storage_set_options_body(Storage storage,
         // storage not found
         return ret;
     } // storage found
+    wp::page_set_meta* psm{};
+    if (wp::find_page_set_meta(storage, psm) == Status::OK &&
+        !psm->get_durable()) {
+        // the non-durable storage keeps its options in memory only
+        psm->set_storage_option(options);
+        return Status::OK;
+    }
     Token s{};
     // get tx handle
     while (enter(s) != Status::OK) { _mm_pause(); }
@@ -293,6 +381,23 @@ Status storage_set_options(Storage storage, storage_option const& options) {
     return ret;
 }
 
+static Status register_merge_operator_body(Storage const storage,
+                                           merge_operator_type&& op) {
+    if (!op) { return Status::WARN_INVALID_ARGS; }
+    if (storage::exist_storage(storage) != Status::OK) {
+        return Status::WARN_NOT_FOUND;
+    }
+    storage::merge_operator_map_set(storage, std::move(op));
+    return Status::OK;
+}
+
+Status register_merge_operator(Storage const storage, merge_operator_type op) {
+    shirakami_log_entry << "register_merge_operator, storage: " << storage;
+    auto ret = register_merge_operator_body(storage, std::move(op));
+    shirakami_log_exit << "register_merge_operator, Status: " << ret;
+    return ret;
+}
+
 Status storage::register_storage(Storage storage, storage_option options) {
     std::string_view storage_view = {
             reinterpret_cast<char*>(&storage), // NOLINT
@@ -376,25 +481,14 @@ Status storage::exist_storage(Storage storage) {
     return Status::WARN_NOT_FOUND;
 }
 
-Status storage::delete_storage(Storage storage) {
-    // NOLINT
-    std::unique_lock lk{garbage::get_mtx_cleaner()};
-
-    std::string_view storage_view = {
-            reinterpret_cast<char*>(&storage), // NOLINT
-            sizeof(storage)};
-    auto ret = yakushima::find_storage(storage_view);
-    if ((ret != yakushima::status::OK) ||
-        (!wp::get_finalizing() && storage == wp::get_page_set_meta_storage())) {
-        return Status::WARN_INVALID_HANDLE;
-    }
-    // exist storage
-
-    std::vector<std::tuple<std::string, Record**, std::size_t>> scan_res;
+/**
+ * @brief release the records (or page set meta at finalizing) which were
+ * detached from the index.
+ */
+static void release_detached_records(
+        std::vector<std::tuple<std::string, Record**, std::size_t>>&
+                scan_res) {
     constexpr std::size_t v_index{1};
-    yakushima::scan(storage_view, "", yakushima::scan_endpoint::INF, "",
-                    yakushima::scan_endpoint::INF, scan_res);
-
     if (scan_res.size() < std::thread::hardware_concurrency() * 10) { // NOLINT
         // single thread clean up
         for (auto&& itr : scan_res) {
@@ -434,6 +528,81 @@ Status storage::delete_storage(Storage storage) {
         }
         for (auto&& th : th_vc) { th.join(); }
     }
+}
+
+/**
+ * @brief detach the index tree from the storage.
+ * @details It moves the root of the tree to a new tree which has the internal
+ * name, so the storage has the empty tree at once without visiting the
+ * records. The caller hands the detached tree to gc.
+ * @param[in] storage_view the name of the storage in the index.
+ * @param[out] name the internal name of the detached tree.
+ * @pre It holds the lock of cleaner, so the cleaner doesn't visit the records
+ * concurrently.
+ */
+static Status detach_tree(std::string_view const storage_view,
+                          std::string& name) {
+    yakushima::tree_instance* src{};
+    auto rc = yakushima::find_storage(storage_view, &src);
+    if (rc != yakushima::status::OK) { return Status::WARN_INVALID_HANDLE; }
+    name = garbage::get_new_detached_tree_name(storage_view);
+    rc = yakushima::create_storage(name);
+    yakushima::tree_instance* dst{};
+    if (rc == yakushima::status::OK) {
+        rc = yakushima::find_storage(name, &dst);
+    }
+    if (rc != yakushima::status::OK) {
+        LOG_FIRST_N(ERROR, 1)
+                << log_location_prefix << rc << ", unreachable path";
+        return Status::ERR_FATAL;
+    }
+    dst->store_root_ptr(src->load_root_ptr());
+    src->store_root_ptr(nullptr);
+    return Status::OK;
+}
+
+/**
+ * @brief hand the detached tree to gc, or release it at once after the
+ * cleaner ended.
+ * @pre It holds the lock of cleaner.
+ */
+static void retire_detached_tree(std::string name) {
+    if (garbage::get_flag_cleaner_end()) {
+        garbage::release_tree(name);
+    } else {
+        garbage::retire_tree(std::move(name));
+    }
+}
+
+Status storage::delete_storage(Storage storage, bool const async) {
+    // NOLINT
+    std::unique_lock lk{garbage::get_mtx_cleaner()};
+
+    std::string_view storage_view = {
+            reinterpret_cast<char*>(&storage), // NOLINT
+            sizeof(storage)};
+    auto ret = yakushima::find_storage(storage_view);
+    if ((ret != yakushima::status::OK) ||
+        (!wp::get_finalizing() && storage == wp::get_page_set_meta_storage())) {
+        return Status::WARN_INVALID_HANDLE;
+    }
+    // exist storage
+
+    /**
+     * The cleaner releases the detached trees at its end, so the records must
+     * be released inline after that.
+     */
+    if (async && !wp::get_finalizing() && !garbage::get_flag_cleaner_end()) {
+        std::string name{};
+        auto rc_dt = detach_tree(storage_view, name);
+        if (rc_dt != Status::OK) { return rc_dt; }
+        retire_detached_tree(std::move(name));
+    } else {
+        std::vector<std::tuple<std::string, Record**, std::size_t>> scan_res;
+        yakushima::scan(storage_view, "", yakushima::scan_endpoint::INF, "",
+                        yakushima::scan_endpoint::INF, scan_res);
+        release_detached_records(scan_res);
+    }
 
     if (!wp::get_finalizing() && storage != storage::meta_storage &&
         storage != storage::sequence_storage) {
@@ -482,6 +651,29 @@ Status storage::delete_storage(Storage storage) {
     return Status::OK;
 }
 
+Status storage::truncate_storage(Storage storage) {
+    std::unique_lock lk{garbage::get_mtx_cleaner()};
+
+    std::string_view storage_view = {
+            reinterpret_cast<char*>(&storage), // NOLINT
+            sizeof(storage)};
+    if (storage == wp::get_page_set_meta_storage() ||
+        storage == storage::meta_storage ||
+        storage == storage::sequence_storage) {
+        return Status::WARN_INVALID_HANDLE;
+    }
+
+    /**
+     * Replace the tree with the empty one. The page set meta of the storage is
+     * kept, so wp and options of the storage are not affected.
+     */
+    std::string name{};
+    auto rc = detach_tree(storage_view, name);
+    if (rc != Status::OK) { return rc; }
+    retire_detached_tree(std::move(name));
+    return Status::OK;
+}
+
 Status storage::list_storage(std::vector<Storage>& out) {
     std::vector<std::pair<std::string, yakushima::tree_instance*>> rec;
     yakushima::list_storages(rec);
@@ -492,6 +684,8 @@ Status storage::list_storage(std::vector<Storage>& out) {
     }
     out.clear();
     for (auto&& elem : rec) {
+        // the tree detached by truncate_storage is not a storage
+        if (elem.first.size() != sizeof(Storage)) { continue; }
         //Due to invariants, the type is known by the developer.
         Storage dest{};
         memcpy(&dest, elem.first.data(), sizeof(dest));
@@ -533,6 +727,9 @@ void storage::fin() {
 
     // clear key storage map
     storage::key_handle_map_clear();
+
+    // clear merge operators
+    storage::merge_operator_map_clear();
 }
 
 } // namespace shirakami
@@ -1,4 +1,14 @@
 
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "concurrency_control/include/footprint.h"
+#include "concurrency_control/include/promotion.h"
 #include "concurrency_control/include/session.h"
 #include "concurrency_control/interface/long_tx/include/long_tx.h"
 #include "concurrency_control/interface/read_only_tx/include/read_only_tx.h"
@@ -11,6 +21,79 @@
 
 namespace shirakami {
 
+/**
+ * @brief collect the storages which the labeled short tx wrote, before the
+ * write set is cleared at commit.
+ * @param[out] out sorted and no duplicates.
+ */
+static void collect_write_storages(session* const ti,
+                                   std::vector<Storage>& out) {
+    auto add = [&out](Storage const st) {
+        // the write set is usually grouped by storage
+        if (out.empty() || out.back() != st) { out.emplace_back(st); }
+    };
+    {
+        std::shared_lock<std::shared_mutex> lk{ti->get_write_set().get_mtx()};
+        if (ti->get_write_set().get_for_batch()) {
+            for (auto&& elem : ti->get_write_set().get_ref_cont_for_bt()) {
+                add(elem.second.get_storage());
+            }
+        } else {
+            for (auto&& wso : ti->get_write_set().get_ref_cont_for_occ()) {
+                add(wso.get_storage());
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+/**
+ * @brief the storages which the labeled short tx writes, taken before the
+ * write set is cleared at commit, to track the result per label.
+ */
+struct short_tx_tracker {
+    explicit short_tx_tracker(session* const ti)
+        : ti_(ti),
+          track_(promotion::is_enabled() && !ti->get_tx_label().empty()) {
+        if (track_) { collect_write_storages(ti_, write_storages_); }
+    }
+
+    void record(Status const rc) {
+        if (!track_) { return; }
+        promotion::record_short_result(ti_->get_tx_label(), rc == Status::OK,
+                                       ti_->get_result_info().get_reason_code(),
+                                       write_storages_);
+    }
+
+private:
+    session* ti_;
+    bool track_;
+    std::vector<Storage> write_storages_{};
+};
+
+/**
+ * @brief set about diagnostics after the commit of short tx.
+ */
+static void set_short_tx_diag(session* const ti, Status const rc) {
+    if (rc == Status::OK) {
+        ti->set_diag_tx_state_kind(TxState::StateKind::WAITING_DURABLE);
+    } else {
+        ti->set_diag_tx_state_kind(TxState::StateKind::ABORTED);
+    }
+}
+
+/**
+ * @brief record the write footprint of the labeled ltx before the write set
+ * is cleared at termination.
+ */
+static void record_write_footprint(session* const ti) {
+    if (ti->get_tx_label().empty()) { return; }
+    std::shared_lock<std::shared_mutex> lk{ti->get_write_set().get_mtx()};
+    footprint::record(ti->get_tx_label(),
+                      ti->get_write_set().get_storage_map());
+}
+
 static Status abort_body(Token token) { // NOLINT
     // clean up local set
     auto* ti = static_cast<session*>(token);
@@ -32,6 +115,8 @@ static Status abort_body(Token token) { // NOLINT
              */
             return Status::WARN_ILLEGAL_OPERATION;
         }
+        // a dry run is aborted after its writes
+        record_write_footprint(ti);
         rc = long_tx::abort(ti);
     } else if (ti->get_tx_type() ==
                transaction_options::transaction_type::READ_ONLY) {
@@ -75,14 +160,12 @@ static Status commit_body(Token const token,                    // NOLINT
     Status rc{};
     if (ti->get_tx_type() == transaction_options::transaction_type::SHORT) {
         // for short tx
+        short_tx_tracker tracker{ti};
         rc = short_tx::commit(ti);
+        tracker.record(rc);
 
         // set about diagnostics
-        if (rc == Status::OK) {
-            ti->set_diag_tx_state_kind(TxState::StateKind::WAITING_DURABLE);
-        } else {
-            ti->set_diag_tx_state_kind(TxState::StateKind::ABORTED);
-        }
+        set_short_tx_diag(ti, rc);
     } else if (ti->get_tx_type() ==
                transaction_options::transaction_type::LONG) {
         // for long tx
@@ -93,8 +176,16 @@ static Status commit_body(Token const token,                    // NOLINT
              */
             return Status::WARN_WAITING_FOR_OTHER_TX;
         }
+        record_write_footprint(ti);
         rc = long_tx::commit(ti);
 
+        // the result of the waiting tx is recorded by the bg commit worker
+        if (promotion::is_enabled() && !ti->get_tx_label().empty() &&
+            rc != Status::WARN_WAITING_FOR_OTHER_TX) {
+            promotion::record_long_result(ti->get_tx_label(),
+                                          rc == Status::OK);
+        }
+
         // set about diagnostics
         if (rc == Status::OK) {
             // committed
@@ -154,6 +245,86 @@ bool commit(Token token, commit_callback_type callback) { // NOLINT
     return ret != Status::WARN_WAITING_FOR_OTHER_TX;
 }
 
+void commit_batch(
+        std::vector<std::pair<Token, commit_callback_type>> const& requests) {
+    shirakami_log_entry << "commit_batch, size: " << requests.size();
+    /**
+     * The strands are locked in the order of the token, so the batches which
+     * have the same tokens in the different orders don't deadlock. The same
+     * token twice would lock its strand twice, so it is rejected.
+     */
+    std::vector<std::size_t> lock_order(requests.size());
+    std::iota(lock_order.begin(), lock_order.end(), 0);
+    std::sort(lock_order.begin(), lock_order.end(),
+              [&requests](std::size_t const a, std::size_t const b) {
+                  return std::less<Token>{}(requests[a].first,
+                                            requests[b].first);
+              });
+    if (std::adjacent_find(lock_order.begin(), lock_order.end(),
+                           [&requests](std::size_t const a,
+                                       std::size_t const b) {
+                               return requests[a].first == requests[b].first;
+                           }) != lock_order.end()) {
+        for (auto&& req : requests) {
+            if (req.second) { req.second(Status::WARN_INVALID_ARGS, {}, 0); }
+        }
+        shirakami_log_exit << "commit_batch, Status: "
+                           << Status::WARN_INVALID_ARGS;
+        return;
+    }
+    std::vector<std::unique_lock<std::shared_mutex>> strands(requests.size());
+    for (auto const i : lock_order) {
+        auto* ti = static_cast<session*>(requests[i].first);
+        ti->process_before_start_step();
+        strands[i] = std::unique_lock<std::shared_mutex>{
+                ti->get_mtx_state_da_term()};
+    }
+
+    std::vector<session*> batch{};
+    std::vector<std::size_t> batch_index{};
+    std::vector<short_tx_tracker> trackers{};
+    batch.reserve(requests.size());
+    batch_index.reserve(requests.size());
+    trackers.reserve(requests.size());
+    // the callbacks of the rejected requests are called after unlock
+    std::vector<std::pair<std::size_t, Status>> rejected{};
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        auto const& req = requests[i];
+        auto* ti = static_cast<session*>(req.first);
+        if (!ti->get_tx_began()) {
+            rejected.emplace_back(i, Status::WARN_NOT_BEGIN);
+        } else if (ti->get_tx_type() !=
+                   transaction_options::transaction_type::SHORT) {
+            rejected.emplace_back(i, Status::WARN_ILLEGAL_OPERATION);
+        } else {
+            ti->set_commit_callback(req.second);
+            batch.emplace_back(ti);
+            batch_index.emplace_back(i);
+            trackers.emplace_back(ti);
+            // hold the strand until the batch is committed
+            continue;
+        }
+        strands[i].unlock();
+        ti->process_before_finish_step();
+    }
+
+    std::vector<Status> results{};
+    short_tx::commit_batch(batch, results);
+
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        trackers.at(i).record(results.at(i));
+        set_short_tx_diag(batch.at(i), results.at(i));
+        strands.at(batch_index.at(i)).unlock();
+        batch.at(i)->process_before_finish_step();
+    }
+
+    for (auto&& elem : rejected) {
+        auto const& callback = requests[elem.first].second;
+        if (callback) { callback(elem.second, {}, 0); }
+    }
+    shirakami_log_exit << "commit_batch";
+}
+
 Status check_commit(Token token) {
     // check commit is for only ltx
     shirakami_log_entry << "check_commit, token: " << token;
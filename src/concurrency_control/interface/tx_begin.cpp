@@ -9,6 +9,7 @@
 #include "include/helper.h"
 
 #include "concurrency_control/include/epoch_internal.h"
+#include "concurrency_control/include/promotion.h"
 #include "concurrency_control/include/session.h"
 #include "concurrency_control/include/wp.h"
 #include "concurrency_control/interface/long_tx/include/long_tx.h"
@@ -41,22 +42,43 @@ static Status tx_begin_body(transaction_options options) { // NOLINT
             options.get_transaction_type();
     transaction_options::write_preserve_type write_preserve =
             options.get_write_preserve();
-    if (!write_preserve.empty()) {
+    ti->set_tx_label(options.get_label());
+    if (tx_type == transaction_options::transaction_type::SHORT &&
+        session::optflag_occ_auto_promotion && promotion::is_enabled() &&
+        !options.get_label().empty() &&
+        promotion::find_promotion(options.get_label(), write_preserve)) {
+        // repeatedly aborting short tx is promoted to long tx
+        tx_type = transaction_options::transaction_type::LONG;
+        promotion::record_auto_promoted_begin(options.get_label());
+        VLOG(log_debug) << log_location_prefix << "the transaction label \""
+                        << options.get_label() << "\" begins as LONG";
+    }
+    transaction_options::write_preserve_range_type write_preserve_range =
+            options.get_write_preserve_range();
+    if (!write_preserve.empty() || !write_preserve_range.empty()) {
         if (tx_type != transaction_options::transaction_type::LONG) {
             // The only ltx can use write preserve.
             return Status::WARN_ILLEGAL_OPERATION;
         }
     }
+    if (options.get_snapshot() != nullptr &&
+        tx_type != transaction_options::transaction_type::READ_ONLY) {
+        // The only rtx can use shared snapshot.
+        return Status::WARN_ILLEGAL_OPERATION;
+    }
     if (tx_type == transaction_options::transaction_type::LONG) {
         ti->init_flags_for_ltx_begin();
 
-        auto rc{long_tx::tx_begin(ti, write_preserve, options.get_read_area())};
+        auto rc{long_tx::tx_begin(ti, write_preserve, write_preserve_range,
+                                  options.get_read_area())};
         if (rc != Status::OK) { return rc; }
     } else if (tx_type == transaction_options::transaction_type::SHORT) {
         ti->init_flags_for_stx_begin();
     } else if (tx_type == transaction_options::transaction_type::READ_ONLY) {
         ti->init_flags_for_rtx_begin();
-        auto rc{read_only_tx::tx_begin(ti)};
+        auto rc{read_only_tx::tx_begin(
+                ti, static_cast<shared_snapshot*>(options.get_snapshot()))};
+        if (rc == Status::WARN_INVALID_HANDLE) { return rc; }
         if (rc != Status::OK) {
             LOG_FIRST_N(ERROR, 1)
                     << log_location_prefix << rc << ", unreachable path";
@@ -97,6 +119,12 @@ static Status tx_begin_body(transaction_options options) { // NOLINT
      * tx began at last.
      */
     ti->set_tx_began(true);
+
+    // ltx and rtx don't wait for the next epoch if expedited
+    if (tx_type != transaction_options::transaction_type::SHORT &&
+        session::optflag_expedite_ltx_start) {
+        epoch::request_expedite_epoch(ti->get_valid_epoch());
+    }
     return Status::OK;
 }
 
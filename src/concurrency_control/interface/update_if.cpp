@@ -0,0 +1,76 @@
+
+#include "concurrency_control/include/session.h"
+#include "concurrency_control/interface/include/helper.h"
+#include "database/include/logging.h"
+
+#include "index/yakushima/include/interface.h"
+
+#include "shirakami/interface.h"
+#include "shirakami/logging.h"
+
+namespace shirakami {
+
+static Status update_if_body(Token token, Storage storage,
+                             std::string_view const key,
+                             std::string_view const expected,
+                             std::string_view const val) {
+    // check constraint: key
+    auto ret = check_constraint_key_length(key);
+    if (ret != Status::OK) { return ret; }
+
+    // take thread info
+    auto* ti = static_cast<session*>(token);
+
+    // check whether it already began.
+    if (!ti->get_tx_began()) { return Status::WARN_NOT_BEGIN; }
+
+    // it is resolved at occ commit phase
+    if (ti->get_tx_type() != transaction_options::transaction_type::SHORT) {
+        return Status::WARN_ILLEGAL_OPERATION;
+    }
+
+    // check for write
+    auto rc{check_before_write_ops(ti, storage, key, OP_TYPE::UPDATE)};
+    if (rc != Status::OK) { return rc; }
+
+    // index access to check local write set
+    Record* rec_ptr{};
+    if (Status::OK == get<Record>(storage, key, rec_ptr)) {
+        // the expected value can't be compared with own write
+        if (ti->get_write_set().search(rec_ptr) != nullptr) {
+            return Status::WARN_ILLEGAL_OPERATION;
+        }
+
+        // check absent
+        tid_word ctid{loadAcquire(rec_ptr->get_tidw_ref().get_obj())};
+        if (ctid.get_absent()) { return Status::WARN_NOT_FOUND; }
+
+        // prepare write without read
+        write_set_obj wso{storage, OP_TYPE::UPDATE, rec_ptr, val, false, {}};
+        wso.set_update_if(expected);
+        ti->push_to_write_set(std::move(wso));
+        return Status::OK;
+    }
+    return Status::WARN_NOT_FOUND;
+}
+
+Status update_if(Token token, Storage storage, std::string_view const key,
+                 std::string_view const expected, std::string_view const val) {
+    shirakami_log_entry << "update_if, token: " << token
+                        << ", storage: " << storage
+                        << "," shirakami_binstring(key) "," shirakami_binstring(expected)
+                           "," shirakami_binstring(val);
+    auto* ti = static_cast<session*>(token);
+    ti->process_before_start_step();
+    Status ret{};
+    { // for strand
+        std::shared_lock<std::shared_mutex> lock{ti->get_mtx_state_da_term()};
+
+        ret = update_if_body(token, storage, key, expected, val);
+    }
+    ti->process_before_finish_step();
+    shirakami_log_exit << "update_if, Status: " << ret;
+    return ret;
+}
+
+} // namespace shirakami
@@ -10,12 +10,22 @@
 
 namespace shirakami {
 
+ongoing_tx::tx_info_type::iterator ongoing_tx::find_id(std::size_t const id) {
+    // @pre lock for tx_info_
+    auto itr = std::lower_bound(
+            tx_info_.begin(), tx_info_.end(), id,
+            [](tx_info_elem_type const& elem, std::size_t const target) {
+                return std::get<ongoing_tx::index_id>(elem) < target;
+            });
+    if (itr != tx_info_.end() && std::get<ongoing_tx::index_id>(*itr) == id) {
+        return itr;
+    }
+    return tx_info_.end();
+}
+
 bool ongoing_tx::exist_id(std::size_t id) {
     std::shared_lock<std::shared_mutex> lk{mtx_};
-    for (auto&& elem : tx_info_) {
-        if (std::get<ongoing_tx::index_id>(elem) == id) { return true; }
-    }
-    return false;
+    return find_id(id) != tx_info_.end();
 }
 
 Status ongoing_tx::waiting_bypass(session* ti) {
@@ -23,10 +33,8 @@ Status ongoing_tx::waiting_bypass(session* ti) {
 
     auto exist_living_wait_for = [](session* target_ti) {
         auto wait_for{target_ti->extract_wait_for()};
-        for (auto&& elem : tx_info_) {
-            auto the_tx_id = std::get<ongoing_tx::index_id>(elem);
-            auto f_itr = wait_for.find(the_tx_id);
-            if (f_itr != wait_for.end()) { return true; }
+        for (auto id : wait_for) {
+            if (find_id(id) != tx_info_.end()) { return true; }
         }
         return false;
     };
@@ -36,12 +44,12 @@ Status ongoing_tx::waiting_bypass(session* ti) {
      */
     auto wait_for{ti->extract_wait_for()};
     std::set<std::tuple<std::size_t, session*>> bypass_target{};
-    for (auto&& elem : tx_info_) {
-        auto the_tx_id = std::get<ongoing_tx::index_id>(elem);
-        auto f_itr = wait_for.find(the_tx_id);
-        if (f_itr != wait_for.end()) {
+    // wait_for is ordered by id, so this is the same order as tx_info_
+    for (auto the_tx_id : wait_for) {
+        auto f_itr = find_id(the_tx_id);
+        if (f_itr != tx_info_.end()) {
             // found
-            auto* token = std::get<ongoing_tx::index_session>(elem);
+            auto* token = std::get<ongoing_tx::index_session>(*f_itr);
 
             // check exist living wait for, for not to remove path to root.
             if (!optflag_waiting_bypass_to_root_ &&
@@ -103,62 +111,46 @@ Status ongoing_tx::waiting_bypass(session* ti) {
     }
 
     // register bypass target information
-    for (auto&& elem : tx_info_) {
-        auto the_tx_id = std::get<ongoing_tx::index_id>(elem);
-        // find from bypass targets
-        for (auto&& bt : bypass_target) {
-            auto bypass_id = std::get<0>(bt);
-            if (bypass_id == the_tx_id) {
-                // hit, register
-                {
-                    auto* bypass_token = std::get<1>(bt);
-                    // get mutex for overtaken ltx set
-                    std::lock_guard<std::shared_mutex> lk{
-                            ti->get_mtx_overtaken_ltx_set()};
-                    std::shared_lock<std::shared_mutex> lk2{
-                            bypass_token->get_mtx_overtaken_ltx_set()};
-                    for (auto&& ols_elem :
-                         bypass_token->get_overtaken_ltx_set()) {
-                        auto* wp_meta_ptr = ols_elem.first;
-                        // find local set
-                        auto local_ols_itr =
-                                ti->get_overtaken_ltx_set().find(wp_meta_ptr);
-                        // overwrite or insert
-                        if (local_ols_itr !=
-                            ti->get_overtaken_ltx_set().end()) {
-                            // hit and overwrite, merge, copy
-                            // merge ids
-                            auto& ols_ids = std::get<0>(local_ols_itr->second);
-                            auto& merge_source_ids =
-                                    std::get<0>(ols_elem.second);
-                            for (auto id : merge_source_ids) {
-                                ols_ids.insert(id);
-                            }
-                            // merge read range, about left endpoint
-                            std::string left_end_source =
-                                    std::get<0>(std::get<1>(ols_elem.second));
-                            std::string& left_end_base = std::get<0>(
-                                    std::get<1>(local_ols_itr->second));
-                            if (left_end_source < left_end_base) {
-                                left_end_base = left_end_source;
-                            }
-                            // about right endpoint
-                            std::string right_end_source =
-                                    std::get<2>(std::get<1>(ols_elem.second));
-                            std::string& right_end_base = std::get<2>(
-                                    std::get<1>(local_ols_itr->second));
-                            if (right_end_base < right_end_source) {
-                                right_end_base = right_end_source;
-                            }
-                        } else {
-                            // not hit and create(copy) element
-                            ti->get_overtaken_ltx_set()[wp_meta_ptr] =
-                                    ols_elem.second;
-                        }
+    for (auto&& bt : bypass_target) {
+        auto* bypass_token = std::get<1>(bt);
+        {
+            // get mutex for overtaken ltx set
+            std::lock_guard<std::shared_mutex> lk{
+                    ti->get_mtx_overtaken_ltx_set()};
+            std::shared_lock<std::shared_mutex> lk2{
+                    bypass_token->get_mtx_overtaken_ltx_set()};
+            for (auto&& ols_elem : bypass_token->get_overtaken_ltx_set()) {
+                auto* wp_meta_ptr = ols_elem.first;
+                // find local set
+                auto local_ols_itr =
+                        ti->get_overtaken_ltx_set().find(wp_meta_ptr);
+                // overwrite or insert
+                if (local_ols_itr != ti->get_overtaken_ltx_set().end()) {
+                    // hit and overwrite, merge, copy
+                    // merge ids
+                    auto& ols_ids = std::get<0>(local_ols_itr->second);
+                    auto& merge_source_ids = std::get<0>(ols_elem.second);
+                    for (auto id : merge_source_ids) { ols_ids.insert(id); }
+                    // merge read range, about left endpoint
+                    std::string left_end_source =
+                            std::get<0>(std::get<1>(ols_elem.second));
+                    std::string& left_end_base =
+                            std::get<0>(std::get<1>(local_ols_itr->second));
+                    if (left_end_source < left_end_base) {
+                        left_end_base = left_end_source;
+                    }
+                    // about right endpoint
+                    std::string right_end_source =
+                            std::get<2>(std::get<1>(ols_elem.second));
+                    std::string& right_end_base =
+                            std::get<2>(std::get<1>(local_ols_itr->second));
+                    if (right_end_base < right_end_source) {
+                        right_end_base = right_end_source;
                     }
+                } else {
+                    // not hit and create(copy) element
+                    ti->get_overtaken_ltx_set()[wp_meta_ptr] = ols_elem.second;
                 }
-                // success and break;
-                break;
             }
         }
     }
@@ -184,11 +176,10 @@ bool ongoing_tx::exist_wait_for(session* ti, Status& out_status) {
         // check boundary wait
         {
             std::shared_lock<std::shared_mutex> lk{mtx_};
-            for (auto&& elem : tx_info_) {
+            for (auto wait_id : wait_for) {
                 // check overwrites
-                if (std::get<ongoing_tx::index_id>(elem) < id) {
-                    if (wait_for.find(std::get<ongoing_tx::index_id>(elem)) !=
-                        wait_for.end()) {
+                if (wait_id < id) {
+                    if (find_id(wait_id) != tx_info_.end()) {
                         // wait_for hit.
                         /**
                          * boundary wait 確定.
@@ -241,38 +232,35 @@ bool ongoing_tx::exist_wait_for(session* ti, Status& out_status) {
 
 void ongoing_tx::push(tx_info_elem_type const ti) {
     std::lock_guard<std::shared_mutex> lk{mtx_};
-    tx_info_.emplace_back(ti);
+    push_bringing_lock(ti);
 }
 
 void ongoing_tx::push_bringing_lock(tx_info_elem_type const ti) {
-    tx_info_.emplace_back(ti);
+    // ids are almost always given in ascending order, so it appends.
+    auto const id = std::get<ongoing_tx::index_id>(ti);
+    if (tx_info_.empty() ||
+        std::get<ongoing_tx::index_id>(tx_info_.back()) < id) {
+        tx_info_.emplace_back(ti);
+    } else {
+        tx_info_.insert(
+                std::lower_bound(tx_info_.begin(), tx_info_.end(), id,
+                                 [](tx_info_elem_type const& elem,
+                                    std::size_t const target) {
+                                     return std::get<ongoing_tx::index_id>(
+                                                    elem) < target;
+                                 }),
+                ti);
+    }
 }
 
 void ongoing_tx::remove_id(std::size_t const id) {
     std::lock_guard<std::shared_mutex> lk{mtx_};
-    epoch::epoch_t lep{0};
-    bool first{true};
-    bool erased{false};
-    for (auto it = tx_info_.begin(); it != tx_info_.end();) { // NOLINT
-        if (!erased && std::get<ongoing_tx::index_id>(*it) == id) {
-            tx_info_.erase(it);
-            // TODO: it = ?
-            erased = true;
-        } else {
-            // update lowest epoch
-            if (first) {
-                lep = std::get<ongoing_tx::index_epoch>(*it);
-                first = false;
-            } else {
-                lep = std::min(lep, std::get<ongoing_tx::index_epoch>(*it));
-            }
-
-            ++it;
-        }
-    }
-    if (!erased) {
+    auto itr = find_id(id);
+    if (itr == tx_info_.end()) {
         LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path.";
+        return;
     }
+    tx_info_.erase(itr);
 }
 
 void ongoing_tx::set_optflags() {
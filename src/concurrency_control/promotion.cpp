@@ -0,0 +1,284 @@
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "cpu.h"
+
+#include "concurrency_control/include/promotion.h"
+#include "concurrency_control/include/session.h"
+
+#include "shirakami/logging.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::promotion {
+
+/**
+ * @brief abort history of the transactions with the same label.
+ * @details The counters are atomic, so the result of each commit is recorded
+ * without an exclusive lock.
+ */
+struct label_info {
+    std::atomic<bool> promoted_{};
+
+    std::atomic<std::uint64_t> consecutive_aborts_{};
+
+    std::atomic<std::uint64_t> short_commits_{};
+
+    std::atomic<std::uint64_t> short_aborts_{};
+
+    std::atomic<std::uint64_t> long_commits_{};
+
+    std::atomic<std::uint64_t> long_aborts_{};
+
+    std::atomic<std::uint64_t> demotions_{};
+
+    std::atomic<std::uint64_t> auto_promoted_begins_{};
+
+    /**
+     * @brief the number of the consecutive aborts of LONG.
+     */
+    std::atomic<std::uint64_t> consecutive_long_aborts_{};
+
+    /**
+     * @brief the number of committed LONG since the last promotion.
+     */
+    std::atomic<std::uint64_t> long_commits_since_promotion_{};
+
+    /**
+     * @brief mutex for @a write_storages_.
+     */
+    std::shared_mutex mtx_write_storages_{};
+
+    /**
+     * @brief the storages which the tx with the label wrote so far.
+     */
+    std::set<Storage> write_storages_{};
+};
+
+/**
+ * @brief a part of the label table. The label is mapped to the shard by its
+ * hash, so the transactions with the different labels rarely share the lock.
+ * The exclusive lock is taken only when a new label is added.
+ */
+struct alignas(CACHE_LINE_SIZE) label_table_shard {
+    std::shared_mutex mtx_{};
+
+    /**
+     * @brief the information is never removed until fin, so the reference to
+     * it is valid without the lock.
+     */
+    std::unordered_map<std::string, std::unique_ptr<label_info>> table_{};
+};
+
+static constexpr std::size_t label_table_shard_num{32};
+
+static std::array<label_table_shard, label_table_shard_num> // NOLINT
+        label_table;
+
+static label_table_shard& get_shard(std::string const& label) {
+    return label_table[std::hash<std::string>{}(label) % // NOLINT
+                       label_table_shard_num];
+}
+
+static label_info* find_label(std::string const& label) {
+    auto& shard = get_shard(label);
+    std::shared_lock<std::shared_mutex> lk{shard.mtx_};
+    auto itr = shard.table_.find(label);
+    return itr == shard.table_.end() ? nullptr : itr->second.get();
+}
+
+static label_info& find_or_add_label(std::string const& label) {
+    auto* info = find_label(label);
+    if (info != nullptr) { return *info; }
+    auto& shard = get_shard(label);
+    std::lock_guard<std::shared_mutex> lk{shard.mtx_};
+    auto& elem = shard.table_[label];
+    if (elem == nullptr) { elem = std::make_unique<label_info>(); }
+    return *elem;
+}
+
+/**
+ * @brief add the storages to the label.
+ * @details The storages of the label are stable after some commits, so it
+ * takes the exclusive lock only if some storage is new.
+ */
+template<class It>
+static void add_write_storages(label_info& info, It first, It last) {
+    {
+        std::shared_lock<std::shared_mutex> lk{info.mtx_write_storages_};
+        if (std::all_of(first, last, [&info](Storage const st) {
+                return info.write_storages_.find(st) !=
+                       info.write_storages_.end();
+            })) {
+            return;
+        }
+    }
+    std::lock_guard<std::shared_mutex> lk{info.mtx_write_storages_};
+    info.write_storages_.insert(first, last);
+}
+
+static std::vector<Storage> get_write_storages(label_info& info) {
+    std::shared_lock<std::shared_mutex> lk{info.mtx_write_storages_};
+    return {info.write_storages_.begin(), info.write_storages_.end()};
+}
+
+static bool is_promotion_target(reason_code const rc) {
+    return rc == reason_code::CC_OCC_READ_VERIFY ||
+           rc == reason_code::CC_OCC_WP_VERIFY;
+}
+
+static void demote(std::string const& label, label_info& info,
+                   char const* const why) {
+    bool expected{true};
+    if (!info.promoted_.compare_exchange_strong(expected, false,
+                                                std::memory_order_acq_rel)) {
+        // demoted concurrently
+        return;
+    }
+    info.consecutive_aborts_.store(0, std::memory_order_relaxed);
+    info.demotions_.fetch_add(1, std::memory_order_relaxed);
+    LOG(INFO) << log_location_prefix << "demote the transaction label \""
+              << label << "\" to SHORT since " << why
+              << ", long commits: "
+              << info.long_commits_.load(std::memory_order_relaxed)
+              << ", long aborts: "
+              << info.long_aborts_.load(std::memory_order_relaxed);
+}
+
+bool is_enabled() { return session::optflag_occ_promotion_threshold != 0; }
+
+void record_short_result(std::string const& label, bool const committed,
+                         reason_code const rc,
+                         std::vector<Storage> const& write_storages) {
+    auto& info = find_or_add_label(label);
+    add_write_storages(info, write_storages.begin(), write_storages.end());
+    if (committed) {
+        info.short_commits_.fetch_add(1, std::memory_order_relaxed);
+        info.consecutive_aborts_.store(0, std::memory_order_relaxed);
+        return;
+    }
+    info.short_aborts_.fetch_add(1, std::memory_order_relaxed);
+    if (!is_promotion_target(rc)) { return; }
+    auto const aborts =
+            info.consecutive_aborts_.fetch_add(1, std::memory_order_relaxed) +
+            1;
+    if (aborts < session::optflag_occ_promotion_threshold) { return; }
+    bool expected{false};
+    if (!info.promoted_.compare_exchange_strong(expected, true,
+                                                std::memory_order_acq_rel)) {
+        // promoted already
+        return;
+    }
+    info.consecutive_long_aborts_.store(0, std::memory_order_relaxed);
+    info.long_commits_since_promotion_.store(0, std::memory_order_relaxed);
+    LOG(INFO) << log_location_prefix << "promote the transaction label \""
+              << label << "\" to LONG after " << aborts
+              << " aborts, short commits: "
+              << info.short_commits_.load(std::memory_order_relaxed)
+              << ", short aborts: "
+              << info.short_aborts_.load(std::memory_order_relaxed)
+              << ", write preserve: " << to_string(get_write_storages(info));
+}
+
+void record_long_result(std::string const& label, bool const committed) {
+    auto& info = find_or_add_label(label);
+    if (committed) {
+        info.long_commits_.fetch_add(1, std::memory_order_relaxed);
+        info.consecutive_long_aborts_.store(0, std::memory_order_relaxed);
+        if (!info.promoted_.load(std::memory_order_acquire)) { return; }
+        auto const commits = info.long_commits_since_promotion_.fetch_add(
+                                     1, std::memory_order_relaxed) +
+                             1;
+        // try short again since the contention may have gone
+        if (session::optflag_occ_promotion_decay != 0 &&
+            commits >= session::optflag_occ_promotion_decay) {
+            demote(label, info, "the promotion decayed");
+        }
+        return;
+    }
+    info.long_aborts_.fetch_add(1, std::memory_order_relaxed);
+    if (!info.promoted_.load(std::memory_order_acquire)) { return; }
+    auto const aborts = info.consecutive_long_aborts_.fetch_add(
+                                1, std::memory_order_relaxed) +
+                        1;
+    // long doesn't help this label
+    if (aborts >= session::optflag_occ_promotion_threshold) {
+        demote(label, info, "LONG also aborted repeatedly");
+    }
+}
+
+void record_auto_promoted_begin(std::string const& label) {
+    auto* info = find_label(label);
+    if (info == nullptr) { return; }
+    info->auto_promoted_begins_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void add_write_storage(std::string const& label, Storage const st) {
+    auto& info = find_or_add_label(label);
+    add_write_storages(info, &st, &st + 1);
+}
+
+bool find_promotion(std::string const& label,
+                    transaction_options::write_preserve_type& wp) {
+    auto* info = find_label(label);
+    if (info == nullptr || !info->promoted_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    wp = get_write_storages(*info);
+    return true;
+}
+
+static void copy_stats(label_info const& info, promotion_stats& out) {
+    out.promoted_ = info.promoted_.load(std::memory_order_acquire);
+    out.consecutive_aborts_ =
+            info.consecutive_aborts_.load(std::memory_order_relaxed);
+    out.short_commits_ = info.short_commits_.load(std::memory_order_relaxed);
+    out.short_aborts_ = info.short_aborts_.load(std::memory_order_relaxed);
+    out.long_commits_ = info.long_commits_.load(std::memory_order_relaxed);
+    out.long_aborts_ = info.long_aborts_.load(std::memory_order_relaxed);
+    out.demotions_ = info.demotions_.load(std::memory_order_relaxed);
+    out.auto_promoted_begins_ =
+            info.auto_promoted_begins_.load(std::memory_order_relaxed);
+}
+
+bool get_stats(std::string const& label, promotion_stats& out) {
+    auto* info = find_label(label);
+    if (info == nullptr) { return false; }
+    copy_stats(*info, out);
+    return true;
+}
+
+void print_diagnostics(std::ostream& out) {
+    for (auto&& shard : label_table) {
+        std::shared_lock<std::shared_mutex> lk{shard.mtx_};
+        for (auto&& elem : shard.table_) {
+            promotion_stats stats{};
+            copy_stats(*elem.second, stats);
+            out << "label: " << elem.first << ", promoted: " << stats.promoted_
+                << ", short commits: " << stats.short_commits_
+                << ", short aborts: " << stats.short_aborts_
+                << ", long commits: " << stats.long_commits_
+                << ", long aborts: " << stats.long_aborts_
+                << ", demotions: " << stats.demotions_
+                << ", auto promoted begins: " << stats.auto_promoted_begins_
+                << '\n';
+        }
+    }
+}
+
+void fin() {
+    for (auto&& shard : label_table) {
+        std::lock_guard<std::shared_mutex> lk{shard.mtx_};
+        shard.table_.clear();
+    }
+}
+
+} // namespace shirakami::promotion
@@ -1,4 +1,11 @@
 
+#include <xmmintrin.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 #include "concurrency_control/include/read_by.h"
 #include "concurrency_control/include/ongoing_tx.h"
 #include "concurrency_control/include/session.h"
@@ -7,12 +14,19 @@
 
 namespace shirakami {
 
-bool point_read_by_long::is_exist(Token token) {
-    auto* ti = static_cast<session*>(token);
-    const epoch::epoch_t epoch = ti->get_valid_epoch();
-    const std::size_t ltx_id = ti->get_long_tx_id();
-    std::shared_lock<std::shared_mutex> lk(mtx_);
-    for (auto&& elem : body_) {
+namespace {
+
+/**
+ * @brief whether some element of higher priority than @a ltx_id is at
+ * @a epoch or later.
+ * @param[in] first the elements ordered by ltx id.
+ */
+template<class It>
+bool exist_higher_priority(It first, It const last, epoch::epoch_t const epoch,
+                           std::size_t const ltx_id) {
+    for (; first != last; ++first) {
+        auto const& elem = *first;
+        if (elem.first == 0) { break; } // unused
         if (elem.second < ltx_id) {
             // elem is high priori than this.
             if (epoch <= elem.first) {
@@ -30,93 +44,212 @@ bool point_read_by_long::is_exist(Token token) {
             break;
         }
     }
-
     return false;
 }
 
+} // namespace
+
+bool point_read_by_long::read_body(body_type& out) {
+    for (;;) {
+        auto v1 = version_.load(std::memory_order_acquire);
+        if ((v1 & 1U) != 0) {
+            // writing
+            _mm_pause();
+            continue;
+        }
+        for (std::size_t i = 0; i < capacity; ++i) {
+            out[i] = {epoch_[i].load(std::memory_order_relaxed),   // NOLINT
+                      ltx_id_[i].load(std::memory_order_relaxed)}; // NOLINT
+        }
+        bool const overflowed = overflowed_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (v1 == version_.load(std::memory_order_relaxed)) {
+            return overflowed;
+        }
+    }
+}
+
+bool point_read_by_long::is_exist(Token token) {
+    auto* ti = static_cast<session*>(token);
+    const epoch::epoch_t epoch = ti->get_valid_epoch();
+    const std::size_t ltx_id = ti->get_long_tx_id();
+    body_type body{};
+    if (!read_body(body)) {
+        // fast path, all elements are in the array
+        return exist_higher_priority(body.begin(), body.end(), epoch, ltx_id);
+    }
+
+    // slow path, the writer holds the mutex while it mutates anything
+    std::unique_lock<std::mutex> lk{mtx_overflow_};
+    for (std::size_t i = 0; i < capacity; ++i) {
+        body[i] = {epoch_[i].load(std::memory_order_relaxed),   // NOLINT
+                   ltx_id_[i].load(std::memory_order_relaxed)}; // NOLINT
+    }
+    auto const last = std::find_if(
+            body.begin(), body.end(),
+            [](body_elem_type const& elem) { return elem.first == 0; });
+    if (exist_higher_priority(body.begin(), last, epoch, ltx_id)) {
+        return true;
+    }
+    if (last != body.end()) { return false; } // overflow_ is empty
+    if (!body.empty() && body.back().second > ltx_id) {
+        // overflow_ is lower priority than this.
+        return false;
+    }
+    return exist_higher_priority(overflow_.begin(), overflow_.end(), epoch,
+                                 ltx_id);
+}
+
 void point_read_by_long::push(body_elem_type const elem) {
+    std::unique_lock<std::mutex> lk{mtx_overflow_};
+
     // lock
-    std::lock_guard<std::shared_mutex> lk(mtx_);
+    auto v = version_.load(std::memory_order_acquire);
+    for (;;) {
+        if ((v & 1U) == 0 &&
+            version_.compare_exchange_weak(v, v + 1,
+                                           std::memory_order_acquire,
+                                           std::memory_order_acquire)) {
+            break;
+        }
+        _mm_pause();
+        v = version_.load(std::memory_order_acquire);
+    }
+    /**
+     * The stores of the elements must not be visible before the odd version.
+     * Readers check the version again after their acquire fence.
+     */
+    std::atomic_thread_fence(std::memory_order_release);
 
     // prepare
     const auto ce = epoch::get_global_epoch();
     auto threshold = epoch::get_cc_safe_ss_epoch();
     if (threshold == 0) { threshold = ce; }
 
-    // gc
-    // TODO at 559: too erase, threshold must be cc safe ss epoch
-    std::size_t erase_count{0};
-    for (auto itr = body_.begin(); itr != body_.end();) { // NOLINT
-        if ((*itr).second < elem.second) {
-            // high priori
-            // check gc
-            if ((*itr).first < threshold) {
-                ++erase_count;
-                ++itr;
-            } else {
-                break;
-            }
-            continue;
-        }
-        if ((*itr).second == elem.second) {
-            LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path";
-            return;
+    // gc and push
+    std::vector<body_elem_type> body{};
+    body.reserve(capacity + overflow_.size() + 1);
+    bool dup{false};
+    auto gc_and_collect = [&body, &dup, &elem,
+                           threshold](body_elem_type const& cur) {
+        if (cur.second == elem.second) { dup = true; }
+        if (cur.first < threshold) { return; } // gc
+        body.emplace_back(cur);
+    };
+    for (std::size_t i = 0; i < capacity; ++i) {
+        body_elem_type cur{epoch_[i].load(std::memory_order_relaxed),  // NOLINT
+                           ltx_id_[i].load(std::memory_order_relaxed)}; // NOLINT
+        if (cur.first == 0) { break; } // unused
+        gc_and_collect(cur);
+    }
+    for (auto&& cur : overflow_) { gc_and_collect(cur); }
+    if (dup) {
+        LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path";
+        version_.store(v + 2, std::memory_order_release);
+        return;
+    }
+    body.emplace_back(elem);
+    std::sort(body.begin(), body.end(),
+              [](body_elem_type const& a, body_elem_type const& b) {
+                  return a.second < b.second;
+              });
+
+    // write back
+    for (std::size_t i = 0; i < capacity; ++i) {
+        if (i < body.size()) {
+            epoch_[i].store(body[i].first, std::memory_order_relaxed);   // NOLINT
+            ltx_id_[i].store(body[i].second, std::memory_order_relaxed); // NOLINT
+        } else {
+            epoch_[i].store(0, std::memory_order_relaxed); // NOLINT
+            ltx_id_[i].store(0, std::memory_order_relaxed); // NOLINT
         }
-        // low priori
-        break;
     }
-    // erase in bulk
-    if (erase_count > 0) {
-        body_.erase(body_.begin(), body_.begin() + erase_count); // NOLINT
+    overflow_.clear();
+    if (body.size() > capacity) {
+        overflow_.assign(body.begin() + capacity, body.end()); // NOLINT
     }
+    overflowed_.store(!overflow_.empty(), std::memory_order_relaxed);
 
-    // push info
-    body_.emplace_back(elem);
+    // unlock
+    version_.store(v + 2, std::memory_order_release);
 }
 
 void point_read_by_long::print() {
+    std::unique_lock<std::mutex> lk{mtx_overflow_};
+    body_type body{};
+    read_body(body);
     LOG(INFO) << ">> print point_read_by_long";
-    for (auto itr = body_.begin(); itr != body_.end();) { // NOLINT
-        LOG(INFO) << (*itr).first << ", " << (*itr).second;
+    for (auto&& elem : body) {
+        if (elem.first == 0) { break; }
+        LOG(INFO) << elem.first << ", " << elem.second;
+    }
+    for (auto&& elem : overflow_) {
+        LOG(INFO) << elem.first << ", " << elem.second;
     }
     LOG(INFO) << "<< print point_read_by_long";
 }
 
+bool range_read_by_long::left_endpoint_less(body_elem_type const& a,
+                                            body_elem_type const& b) {
+    if (std::get<index_l_ep>(b) == scan_endpoint::INF) { return false; }
+    if (std::get<index_l_ep>(a) == scan_endpoint::INF) { return true; }
+    return std::get<index_l_key>(a) < std::get<index_l_key>(b);
+}
+
+bool range_read_by_long::right_endpoint_less(body_elem_type const& a,
+                                             body_elem_type const& b) {
+    if (std::get<index_r_ep>(a) == scan_endpoint::INF) { return false; }
+    if (std::get<index_r_ep>(b) == scan_endpoint::INF) { return true; }
+    return std::get<index_r_key>(a) < std::get<index_r_key>(b);
+}
+
+bool range_read_by_long::includes(body_elem_type const& elem,
+                                  std::string_view const key) {
+    // check the key is right from left point
+    if (std::get<index_l_ep>(elem) == scan_endpoint::INF || // inf
+        std::get<index_l_key>(elem) < key ||                // right
+        (std::get<index_l_key>(elem) == key &&
+         std::get<index_l_ep>(elem) == scan_endpoint::INCLUSIVE) // same
+    ) {
+        // check the key is left from right point
+        if (std::get<index_r_ep>(elem) == scan_endpoint::INF || // inf
+            std::get<index_r_key>(elem) > key ||                // left
+            (std::get<index_r_key>(elem) == key &&
+             std::get<index_r_ep>(elem) == scan_endpoint::INCLUSIVE) // same
+        ) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool range_read_by_long::is_exist(epoch::epoch_t const ep,
                                   std::size_t const ltx_id,
                                   std::string_view const key) {
-    std::unique_lock<std::mutex> lk(mtx_);
-    for (auto&& elem : body_) {
-        if (ltx_id > std::get<range_read_by_long::index_tx_id>(elem)) {
-            // check against higher priori ltxs
-            if (std::get<range_read_by_long::index_epoch>(elem) == ep) {
-                // check the key is right from left point
-                if (std::get<range_read_by_long::index_l_ep>(elem) ==
-                            scan_endpoint::INF || // inf
-                    std::get<range_read_by_long::index_l_key>(elem) <
-                            key || // right
-                    (std::get<range_read_by_long::index_l_key>(elem) == key &&
-                     std::get<range_read_by_long::index_l_ep>(elem) ==
-                             scan_endpoint::INCLUSIVE) // same
-                ) {
-                    // check the key is left from right point
-                    if (std::get<range_read_by_long::index_r_ep>(elem) ==
-                                scan_endpoint::INF || // inf
-                        std::get<range_read_by_long::index_r_key>(elem) >
-                                key || // left
-                        (std::get<range_read_by_long::index_r_key>(elem) ==
-                                 key &&
-                         std::get<range_read_by_long::index_r_ep>(elem) ==
-                                 scan_endpoint::INCLUSIVE) // same
-                    ) {
-                        return true;
-                    }
-                }
-            }
-            if (std::get<range_read_by_long::index_epoch>(elem) > ep) {
-                // no more due to invariant
-                break;
-            }
+    std::shared_lock<std::shared_mutex> lk(mtx_);
+    auto p_itr = body_.find(ep);
+    if (p_itr == body_.end()) { return false; }
+    auto const& ranges = p_itr->second.ranges_;
+    auto const& max_right_pos = p_itr->second.max_right_pos_;
+
+    // the ranges before this can include the key by the left endpoint
+    auto end = std::upper_bound(
+            ranges.begin(), ranges.end(), key,
+            [](std::string_view const k, body_elem_type const& elem) {
+                return std::get<index_l_ep>(elem) != scan_endpoint::INF &&
+                       k < std::get<index_l_key>(elem);
+            });
+    for (auto i = static_cast<std::size_t>(end - ranges.begin()); i > 0; --i) {
+        // no range in the prefix reaches the key
+        auto const& max_right = ranges[max_right_pos[i - 1]];
+        if (std::get<index_r_ep>(max_right) != scan_endpoint::INF &&
+            std::get<index_r_key>(max_right) < key) {
+            break;
+        }
+        auto const& elem = ranges[i - 1];
+        // check against higher priori ltxs
+        if (ltx_id > std::get<index_tx_id>(elem) && includes(elem, key)) {
+            return true;
         }
     }
 
@@ -125,42 +258,35 @@ bool range_read_by_long::is_exist(epoch::epoch_t const ep,
 
 void range_read_by_long::push(body_elem_type const& elem) {
     // lock
-    std::unique_lock<std::mutex> lk(mtx_);
+    std::lock_guard<std::shared_mutex> lk(mtx_);
 
     // prepare
     const auto ce = epoch::get_global_epoch();
     auto gc_threshold = epoch::get_cc_safe_ss_epoch();
     if (gc_threshold == 0) { gc_threshold = ce; }
-    std::size_t tx_id = std::get<range_read_by_long::index_tx_id>(elem);
-
-    // gc
-    std::size_t erase_count{0};
-    for (auto itr = body_.begin(); itr != body_.end();) { // NOLINT
-        if (std::get<range_read_by_long::index_tx_id>(*itr) < tx_id) {
-            // high priori
-            if (std::get<range_read_by_long::index_epoch>(*itr) <
-                gc_threshold) {
-                // gc
-                ++itr;
-                ++erase_count;
-                continue;
-            }
-            // can't gc
-            break;
-        }
-        /**
-         * Now, there is a case the ltx can commit ahead of high priori ltx.
-         */
-        break;
-    }
 
-    // erase in bulk
-    if (erase_count > 0) {
-        body_.erase(body_.begin(), body_.begin() + erase_count); // NOLINT
-    }
+    // gc in bulk
+    body_.erase(body_.begin(), body_.lower_bound(gc_threshold));
 
     // push info
-    body_.emplace_back(elem);
+    auto& part = body_[std::get<index_epoch>(elem)];
+    auto& ranges = part.ranges_;
+    auto& max_right_pos = part.max_right_pos_;
+    auto pos = static_cast<std::size_t>(
+            std::upper_bound(ranges.begin(), ranges.end(), elem,
+                             left_endpoint_less) -
+            ranges.begin());
+    ranges.insert(ranges.begin() + pos, elem); // NOLINT
+    max_right_pos.emplace_back();
+    // update prefix maximum of right endpoint after the inserted position
+    for (std::size_t i = pos; i < ranges.size(); ++i) {
+        if (i == 0 ||
+            right_endpoint_less(ranges[max_right_pos[i - 1]], ranges[i])) {
+            max_right_pos[i] = i;
+        } else {
+            max_right_pos[i] = max_right_pos[i - 1];
+        }
+    }
 }
 
 bool point_read_by_short::find(epoch::epoch_t const epoch) {
@@ -29,8 +29,14 @@ bool read_plan::check_range_overlap(
 
 bool read_plan::check_potential_read_anti(std::size_t const tx_id,
                                           Token token) {
+    auto const& smap =
+            static_cast<session*>(token)->get_write_set().get_storage_map();
+    // filter of the write storages, computed once for all the plans
+    std::uint64_t wmask{0};
+    for (auto&& st : smap) { wmask |= storage_bit(st.first); }
+
     std::shared_lock<std::shared_mutex> lk{get_mtx_cont()};
-    for (auto elem : get_cont()) {
+    for (auto&& elem : get_cont()) {
         if (elem.first > tx_id) {
             LOG_FIRST_N(ERROR, 1)
                     << log_location_prefix
@@ -40,53 +46,52 @@ bool read_plan::check_potential_read_anti(std::size_t const tx_id,
         }
         if (elem.first == tx_id) { return false; }
         // elem is high priori tx
-        auto plist = std::get<0>(elem.second);
-        auto nlist = std::get<1>(elem.second);
+        auto const& cp = elem.second;
 
         // cond1 empty and empty
-        if (plist.empty() && nlist.empty()) {
+        if (cp.pmask_ == 0 && cp.nstorages_.empty()) {
             // it may read all
             return true;
         }
 
-        for (auto&& st :
-             static_cast<session*>(token)->get_write_set().get_storage_map()) {
-            // cond3 only nlist
-            if (plist.empty()) {
-                // the higher priori ltx is not submitted commit
-                auto itr = nlist.find(st.first);
-                if (itr == nlist.end()) {
+        // cond3 only nlist
+        if (cp.pmask_ == 0) {
+            for (auto&& st : smap) {
+                if (!std::binary_search(cp.nstorages_.begin(),
+                                        cp.nstorages_.end(), st.first)) {
                     // the high priori ltx may read this
                     return true;
                 }
             }
+            continue;
+        }
 
-            // cond2,4 only plist or both: check write and plist conlifct
-            if (nlist.empty() || (!plist.empty() && !nlist.empty())) {
-                // find plist
-                for (auto&& p_elem : plist) {
-                    // if the high priori ltx didn't submit commit, check
-                    // storage level
-                    if (!std::get<1>(p_elem)) {
-                        // it didn't submit commit
-                        if (std::get<0>(p_elem) == st.first) {
-                            // hit
-                            return true;
-                        }
-                    } else {
-                        // it submit commit
-                        // check conflict storage level
-                        if (std::get<0>(p_elem) == st.first) {
-                            // check key range level
-                            // todo: use constant value, not magic number
-                            bool hit = check_range_overlap(
-                                    std::get<0>(st.second), std::get<1>(st.second),
-                                    std::get<2>(p_elem), std::get<3>(p_elem),
-                                    std::get<4>(p_elem), std::get<5>(p_elem)); // NOLINT
-                            if (hit) { return true; }
-                        }
-                    }
-                }
+        // cond2,4 only plist or both: check write and plist conlifct
+        if ((cp.pmask_ & wmask) == 0) {
+            // no write storage is in plist
+            continue;
+        }
+        for (auto&& st : smap) {
+            if ((cp.pmask_ & storage_bit(st.first)) == 0) { continue; }
+            // if the high priori ltx didn't submit commit, check storage
+            // level
+            if (std::binary_search(cp.pstorages_.begin(), cp.pstorages_.end(),
+                                   st.first)) {
+                return true;
+            }
+            // it submit commit, check key range level
+            auto itr = std::lower_bound(
+                    cp.pranges_.begin(), cp.pranges_.end(), st.first,
+                    [](compiled_plan::range_type const& r, Storage const s) {
+                        return std::get<0>(r) < s;
+                    });
+            for (; itr != cp.pranges_.end() && std::get<0>(*itr) == st.first;
+                 ++itr) {
+                bool hit = check_range_overlap(
+                        std::get<0>(st.second), std::get<1>(st.second),
+                        std::get<1>(*itr), std::get<2>(*itr),
+                        std::get<3>(*itr), std::get<4>(*itr)); // NOLINT
+                if (hit) { return true; }
             }
         }
     }
@@ -1,4 +1,7 @@
 
+#include <cstdlib>
+#include <cstring>
+
 #include "sequence.h"
 #include "storage.h"
 
@@ -27,6 +30,7 @@ void session::clear_local_set() {
     clear_ltx_storage_read_set();
     clear_range_read_by_short_set();
     clear_read_set_for_stx();
+    set_ct_op_since_read_verify(0);
     read_set_for_ltx().clear();
     wp_set_.clear();
     write_set_.clear();
@@ -229,6 +233,143 @@ void session::set_envflags() {
 
     VLOG(log_debug) << log_location_prefix << "optflag: RTX da/term mutex "
                     << (optflag_rtx_da_term_mutex ? "on" : "off");
+
+    // check environ "SHIRAKAMI_OCC_EARLY_READ_VERIFY_INTERVAL"
+    std::size_t early_read_verify_interval = 0;
+    if (auto* envstr = std::getenv("SHIRAKAMI_OCC_EARLY_READ_VERIFY_INTERVAL");
+        envstr != nullptr && *envstr != '\0') {
+        char* end{};
+        auto val = std::strtoul(envstr, &end, 10); // NOLINT
+        if (*end == '\0') {
+            early_read_verify_interval = val;
+        } else {
+            VLOG(log_debug)
+                    << log_location_prefix << "invalid value is set for "
+                    << "SHIRAKAMI_OCC_EARLY_READ_VERIFY_INTERVAL; using default "
+                       "value";
+        }
+    }
+    optflag_occ_early_read_verify_interval = early_read_verify_interval;
+
+    VLOG(log_debug) << log_location_prefix
+                    << "optflag: OCC early read verify interval "
+                    << optflag_occ_early_read_verify_interval;
+
+    // check environ "SHIRAKAMI_OCC_LOCK_CONTENTION_POLICY"
+    auto lock_policy = lock_contention_policy::SPIN;
+    if (auto* envstr = std::getenv("SHIRAKAMI_OCC_LOCK_CONTENTION_POLICY");
+        envstr != nullptr && *envstr != '\0') {
+        if (std::strcmp(envstr, "spin") == 0) {
+            lock_policy = lock_contention_policy::SPIN;
+        } else if (std::strcmp(envstr, "backoff") == 0) {
+            lock_policy = lock_contention_policy::BACKOFF;
+        } else if (std::strcmp(envstr, "bounded_spin") == 0) {
+            lock_policy = lock_contention_policy::BOUNDED_SPIN;
+        } else if (std::strcmp(envstr, "no_wait") == 0) {
+            lock_policy = lock_contention_policy::NO_WAIT;
+        } else {
+            VLOG(log_debug)
+                    << log_location_prefix << "invalid value is set for "
+                    << "SHIRAKAMI_OCC_LOCK_CONTENTION_POLICY; using default "
+                       "value";
+        }
+    }
+    optflag_occ_lock_contention_policy = lock_policy;
+
+    // check environ "SHIRAKAMI_OCC_LOCK_SPIN_BOUND"
+    std::size_t lock_spin_bound = 1000; // NOLINT
+    if (auto* envstr = std::getenv("SHIRAKAMI_OCC_LOCK_SPIN_BOUND");
+        envstr != nullptr && *envstr != '\0') {
+        char* end{};
+        auto val = std::strtoul(envstr, &end, 10); // NOLINT
+        if (*end == '\0') {
+            lock_spin_bound = val;
+        } else {
+            VLOG(log_debug)
+                    << log_location_prefix << "invalid value is set for "
+                    << "SHIRAKAMI_OCC_LOCK_SPIN_BOUND; using default value";
+        }
+    }
+    optflag_occ_lock_spin_bound = lock_spin_bound;
+
+    VLOG(log_debug) << log_location_prefix
+                    << "optflag: OCC lock contention policy "
+                    << static_cast<int>(optflag_occ_lock_contention_policy)
+                    << ", spin bound " << optflag_occ_lock_spin_bound;
+
+    // check environ "SHIRAKAMI_EXPEDITE_LTX_START"
+    bool expedite_ltx_start = false;
+    if (auto* envstr = std::getenv("SHIRAKAMI_EXPEDITE_LTX_START");
+        envstr != nullptr && *envstr != '\0') {
+        if (std::strcmp(envstr, "1") == 0) {
+            expedite_ltx_start = true;
+        } else if (std::strcmp(envstr, "0") == 0) {
+            expedite_ltx_start = false;
+        } else {
+            VLOG(log_debug)
+                    << log_location_prefix << "invalid value is set for "
+                    << "SHIRAKAMI_EXPEDITE_LTX_START; using default value";
+        }
+    }
+    optflag_expedite_ltx_start = expedite_ltx_start;
+
+    VLOG(log_debug) << log_location_prefix << "optflag: expedite LTX start "
+                    << (optflag_expedite_ltx_start ? "on" : "off");
+
+    // check environ "SHIRAKAMI_OCC_PROMOTION_THRESHOLD"
+    std::size_t promotion_threshold = 0;
+    if (auto* envstr = std::getenv("SHIRAKAMI_OCC_PROMOTION_THRESHOLD");
+        envstr != nullptr && *envstr != '\0') {
+        char* end{};
+        auto val = std::strtoul(envstr, &end, 10); // NOLINT
+        if (*end == '\0') {
+            promotion_threshold = val;
+        } else {
+            VLOG(log_debug)
+                    << log_location_prefix << "invalid value is set for "
+                    << "SHIRAKAMI_OCC_PROMOTION_THRESHOLD; using default "
+                       "value";
+        }
+    }
+    optflag_occ_promotion_threshold = promotion_threshold;
+
+    // check environ "SHIRAKAMI_OCC_AUTO_PROMOTION"
+    bool auto_promotion = false;
+    if (auto* envstr = std::getenv("SHIRAKAMI_OCC_AUTO_PROMOTION");
+        envstr != nullptr && *envstr != '\0') {
+        if (std::strcmp(envstr, "1") == 0) {
+            auto_promotion = true;
+        } else if (std::strcmp(envstr, "0") == 0) {
+            auto_promotion = false;
+        } else {
+            VLOG(log_debug)
+                    << log_location_prefix << "invalid value is set for "
+                    << "SHIRAKAMI_OCC_AUTO_PROMOTION; using default value";
+        }
+    }
+    optflag_occ_auto_promotion = auto_promotion;
+
+    // check environ "SHIRAKAMI_OCC_PROMOTION_DECAY"
+    std::size_t promotion_decay = 1000; // NOLINT
+    if (auto* envstr = std::getenv("SHIRAKAMI_OCC_PROMOTION_DECAY");
+        envstr != nullptr && *envstr != '\0') {
+        char* end{};
+        auto val = std::strtoul(envstr, &end, 10); // NOLINT
+        if (*end == '\0') {
+            promotion_decay = val;
+        } else {
+            VLOG(log_debug)
+                    << log_location_prefix << "invalid value is set for "
+                    << "SHIRAKAMI_OCC_PROMOTION_DECAY; using default value";
+        }
+    }
+    optflag_occ_promotion_decay = promotion_decay;
+
+    VLOG(log_debug) << log_location_prefix
+                    << "optflag: OCC promotion threshold "
+                    << optflag_occ_promotion_threshold << ", auto promotion "
+                    << (optflag_occ_auto_promotion ? "on" : "off")
+                    << ", promotion decay " << optflag_occ_promotion_decay;
 }
 
 // ========== end: result info
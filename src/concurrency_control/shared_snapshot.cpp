@@ -0,0 +1,163 @@
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+
+#include "atomic_wrapper.h"
+
+#include "concurrency_control/include/shared_snapshot.h"
+#include "concurrency_control/interface/long_tx/include/long_tx.h"
+
+#include "shirakami/logging.h"
+
+#include "glog/logging.h"
+
+namespace shirakami {
+
+/**
+ * @brief mutex for @a live_snapshots and the reference counts.
+ */
+static std::mutex mtx_live_snapshots; // NOLINT
+
+/**
+ * @brief the snapshots which are not freed yet.
+ */
+static std::set<shared_snapshot*> live_snapshots; // NOLINT
+
+void shared_snapshot::traverse(Record* const rec_ptr,
+                               resolved_version& out) const {
+    for (;;) {
+        version* ver{};
+        bool is_latest{};
+        tid_word f_check{};
+        auto rc = long_tx::version_function_with_optimistic_check(
+                rec_ptr, get_epoch(), ver, is_latest, f_check);
+        if (rc == Status::WARN_NOT_FOUND) {
+            // no version is visible
+            out = {nullptr, true};
+            return;
+        }
+        if (rc != Status::OK) {
+            LOG_FIRST_N(ERROR, 1) << log_location_prefix << "unreachable path";
+            out = {nullptr, true};
+            return;
+        }
+        if (!is_latest) {
+            out = {ver, ver->get_tid().get_absent()};
+            return;
+        }
+        if (ver == rec_ptr->get_latest() &&
+            loadAcquire(&rec_ptr->get_tidw_ref().get_obj()) ==
+                    f_check.get_obj()) {
+            // success optimistic read latest version
+            out = {ver, f_check.get_absent()};
+            return;
+        }
+        // fail to do optimistic read latest version, retry
+    }
+}
+
+void shared_snapshot::resolve_version(Record* const rec_ptr,
+                                      resolved_version& out) {
+    auto const home = get_home_slot(rec_ptr);
+    for (std::size_t i = 0; i < cache_max_probe; ++i) {
+        auto& slot = cache_[(home + i) & (cache_size - 1)]; // NOLINT
+        auto* rec = slot.rec_.load(std::memory_order_acquire);
+        if (rec == nullptr) { break; }
+        if (rec != rec_ptr) { continue; }
+        auto resolved = slot.resolved_.load(std::memory_order_acquire);
+        if ((resolved & resolved_bit) == 0) {
+            // claimed but not published yet, resolve it by self
+            break;
+        }
+        out = {reinterpret_cast<version*>( // NOLINT
+                       resolved & ~(resolved_bit | absent_bit)),
+               (resolved & absent_bit) != 0};
+        return;
+    }
+
+    traverse(rec_ptr, out);
+
+    /**
+     * The record of the cached version is not unhooked while this snapshot
+     * pins gc because the version is visible at the snapshot. If the record
+     * was absent at the snapshot and it is unhooked, another record may be
+     * allocated at the same address, but it is inserted after the snapshot
+     * and the cached result is still correct.
+     */
+    auto resolved = reinterpret_cast<std::uintptr_t>(out.ver_) | // NOLINT
+                    resolved_bit | (out.absent_ ? absent_bit : 0U);
+    for (std::size_t i = 0; i < cache_max_probe; ++i) {
+        auto& slot = cache_[(home + i) & (cache_size - 1)]; // NOLINT
+        Record* expected{nullptr};
+        if (slot.rec_.compare_exchange_strong(expected, rec_ptr,
+                                              std::memory_order_acq_rel)) {
+            slot.resolved_.store(resolved, std::memory_order_release);
+            return;
+        }
+        // claimed by other thread
+        if (expected == rec_ptr) { return; }
+    }
+    // probe sequence is full, not cached
+}
+
+void shared_snapshot::open(epoch::epoch_t const ep, shared_snapshot*& out) {
+    out = new shared_snapshot(ep); // NOLINT
+    std::lock_guard<std::mutex> lk{mtx_live_snapshots};
+    live_snapshots.insert(out);
+}
+
+Status shared_snapshot::close(shared_snapshot* const ss) {
+    std::lock_guard<std::mutex> lk{mtx_live_snapshots};
+    auto itr = live_snapshots.find(ss);
+    if (itr == live_snapshots.end() || !ss->opened_) {
+        return Status::WARN_INVALID_HANDLE;
+    }
+    ss->opened_ = false;
+    if (--ss->ref_count_ == 0) {
+        live_snapshots.erase(itr);
+        delete ss; // NOLINT
+    }
+    return Status::OK;
+}
+
+Status shared_snapshot::attach(shared_snapshot* const ss) {
+    std::lock_guard<std::mutex> lk{mtx_live_snapshots};
+    if (live_snapshots.find(ss) == live_snapshots.end() || !ss->opened_) {
+        return Status::WARN_INVALID_HANDLE;
+    }
+    ++ss->ref_count_;
+    return Status::OK;
+}
+
+void shared_snapshot::detach(shared_snapshot* const ss) {
+    std::lock_guard<std::mutex> lk{mtx_live_snapshots};
+    auto itr = live_snapshots.find(ss);
+    if (itr == live_snapshots.end()) {
+        // freed by fin
+        return;
+    }
+    if (--ss->ref_count_ == 0) {
+        live_snapshots.erase(itr);
+        delete ss; // NOLINT
+    }
+}
+
+epoch::epoch_t shared_snapshot::get_min_epoch() {
+    std::lock_guard<std::mutex> lk{mtx_live_snapshots};
+    epoch::epoch_t ret{0};
+    for (auto* ss : live_snapshots) {
+        ret = ret == 0 ? ss->get_epoch() : std::min(ret, ss->get_epoch());
+    }
+    return ret;
+}
+
+void shared_snapshot::fin() {
+    std::lock_guard<std::mutex> lk{mtx_live_snapshots};
+    for (auto* ss : live_snapshots) {
+        delete ss; // NOLINT
+    }
+    live_snapshots.clear();
+}
+
+} // namespace shirakami
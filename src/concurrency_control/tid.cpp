@@ -33,6 +33,46 @@ void tid_word::lock(bool by_gc) { // NOLINT
     }
 }
 
+bool tid_word::lock(lock_contention_policy const policy,
+                    std::size_t const spin_bound) {
+    // upper bound of the pause iterations of backoff
+    constexpr std::size_t max_backoff{1024};
+    std::size_t backoff{1};
+    std::size_t retry{0};
+    tid_word expected;
+    tid_word desired;
+    expected.get_obj() = loadAcquire(get_obj());
+    for (;;) {
+        if (expected.get_lock()) {
+            switch (policy) {
+                case lock_contention_policy::NO_WAIT:
+                    return false;
+                case lock_contention_policy::BOUNDED_SPIN:
+                    if (retry >= spin_bound) { return false; }
+                    ++retry;
+                    _mm_pause();
+                    break;
+                case lock_contention_policy::BACKOFF:
+                    for (std::size_t i = 0; i < backoff; ++i) { _mm_pause(); }
+                    if (backoff < max_backoff) { backoff <<= 1U; }
+                    break;
+                default: // SPIN
+                    _mm_pause();
+                    break;
+            }
+            expected.get_obj() = loadAcquire(get_obj());
+        } else {
+            desired = expected;
+            desired.set_lock(true);
+            desired.set_lock_by_gc(false);
+            if (compareExchange(get_obj(), expected.get_obj(),
+                                desired.get_obj())) {
+                return true;
+            }
+        }
+    }
+}
+
 void tid_word::display() {
     std::cout << "obj_ : " << std::bitset<sizeof(obj_) * 8>(obj_) // NOLINT
               << std::endl;                                       // NOLINT
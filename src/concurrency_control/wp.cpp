@@ -1,5 +1,6 @@
 
 #include <algorithm>
+#include <map>
 #include <string_view>
 #include <vector>
 
@@ -181,6 +182,12 @@ Status find_page_set_meta(Storage st, page_set_meta*& ret) {
     return Status::OK;
 }
 
+bool is_durable_storage(Storage const st) {
+    page_set_meta* psm{};
+    if (find_page_set_meta(st, psm) != Status::OK) { return true; }
+    return psm->get_durable();
+}
+
 Status find_read_by(Storage const st, range_read_by_long*& ret) {
     page_set_meta* psm{};
     auto rc{find_page_set_meta(st, psm)};
@@ -221,8 +228,28 @@ Status init() {
     return Status::OK;
 }
 
-Status write_preserve(Token token, std::vector<Storage> storage,
-                      std::size_t long_tx_id, epoch::epoch_t valid_epoch) {
+Status write_preserve(
+        Token token, std::vector<Storage> storage,
+        transaction_options::write_preserve_range_type const& range,
+        std::size_t long_tx_id, epoch::epoch_t valid_epoch) {
+    // decide key range for each storage, the range covering all the ranges
+    std::map<Storage, std::tuple<std::string, std::string>> key_range{};
+    for (auto&& elem : range) {
+        auto& [st, left, right] = elem;
+        auto itr = key_range.find(st);
+        if (itr == key_range.end()) {
+            key_range.emplace(st, std::make_tuple(left, right));
+            continue;
+        }
+        if (left < std::get<0>(itr->second)) { std::get<0>(itr->second) = left; }
+        if (std::get<1>(itr->second) < right) {
+            std::get<1>(itr->second) = right;
+        }
+    }
+    // the storage preserved entirely doesn't use key range
+    for (auto&& st : storage) { key_range.erase(st); }
+    for (auto&& elem : key_range) { storage.emplace_back(elem.first); }
+
     // decide storage form
     // reduce redundant
     auto* ti = static_cast<session*>(token);
@@ -265,8 +292,16 @@ Status write_preserve(Token token, std::vector<Storage> storage,
         wp_meta* target_wp_meta =
                 (reinterpret_cast<page_set_meta*>(out.first)) // NOLINT
                         ->get_wp_meta_ptr();
+        // the range must be visible before the wp
+        auto kr_itr = key_range.find(wp_target);
+        if (kr_itr != key_range.end()) {
+            target_wp_meta->push_wp_key_range(long_tx_id,
+                                              std::get<0>(kr_itr->second),
+                                              std::get<1>(kr_itr->second));
+        }
         if (target_wp_meta->register_wp(valid_epoch, long_tx_id) !=
             Status::OK) {
+            target_wp_meta->remove_wp_key_range(long_tx_id);
             cleanup_process();
             return Status::ERR_FATAL;
         }
@@ -158,6 +158,8 @@ wp_meta::register_wp_result_and_remove_wp(wp_result_elem_type const& elem) {
             set_wped(i, {0, 0});
             wped_used_.reset(i);
             wp_lock_.unlock();
+            // after removing wp, the others see no wp for the tx
+            remove_wp_key_range(id);
             return Status::OK;
         }
     }
@@ -203,4 +205,85 @@ bool wp_meta::read_write_range(std::size_t txid, std::string& out_left_key,
     return true;
 }
 
+void wp_meta::push_wp_key_range(std::size_t const txid,
+                                std::string_view const left_key,
+                                std::string_view const right_key) {
+    std::lock_guard<std::shared_mutex> lk{mtx_wp_key_range_};
+    auto ret_pair =
+            wp_key_range_.emplace(txid, std::make_tuple(left_key, right_key));
+    if (!ret_pair.second) {
+        LOG_FIRST_N(ERROR, 1) << log_location_prefix
+                              << "programming error. tx do this only once.";
+        return;
+    }
+    wp_key_range_num_.store(wp_key_range_.size(), std::memory_order_release);
+}
+
+void wp_meta::remove_wp_key_range(std::size_t const txid) {
+    if (wp_key_range_num_.load(std::memory_order_acquire) == 0) { return; }
+    std::lock_guard<std::shared_mutex> lk{mtx_wp_key_range_};
+    wp_key_range_.erase(txid);
+    wp_key_range_num_.store(wp_key_range_.size(), std::memory_order_release);
+}
+
+bool wp_meta::is_key_preserved(std::size_t const txid,
+                               std::string_view const key) {
+    if (wp_key_range_num_.load(std::memory_order_acquire) == 0) {
+        return true;
+    }
+    std::shared_lock<std::shared_mutex> lk{mtx_wp_key_range_};
+    auto itr = wp_key_range_.find(txid);
+    if (itr == wp_key_range_.end()) { return true; } // whole storage
+    return std::get<0>(itr->second) <= key && key <= std::get<1>(itr->second);
+}
+
+epoch::epoch_t wp_meta::find_min_ep_for_key(const wp_meta::wped_type& wped,
+                                            std::string_view const key) {
+    if (wp_key_range_num_.load(std::memory_order_acquire) == 0) {
+        return find_min_ep(wped);
+    }
+    epoch::epoch_t min_ep{0};
+    std::shared_lock<std::shared_mutex> lk{mtx_wp_key_range_};
+    for (auto&& elem : wped) {
+        if (elem.first == 0) { continue; } // not used slot
+        auto itr = wp_key_range_.find(elem.second);
+        if (itr != wp_key_range_.end() &&
+            (key < std::get<0>(itr->second) ||
+             std::get<1>(itr->second) < key)) {
+            continue; // out of the range
+        }
+        if (min_ep == 0 || elem.first < min_ep) { min_ep = elem.first; }
+    }
+    return min_ep;
+}
+
+epoch::epoch_t wp_meta::find_min_ep_for_range(const wp_meta::wped_type& wped,
+                                              std::string_view const l_key,
+                                              scan_endpoint const l_end,
+                                              std::string_view const r_key,
+                                              scan_endpoint const r_end) {
+    if (wp_key_range_num_.load(std::memory_order_acquire) == 0) {
+        return find_min_ep(wped);
+    }
+    epoch::epoch_t min_ep{0};
+    std::shared_lock<std::shared_mutex> lk{mtx_wp_key_range_};
+    for (auto&& elem : wped) {
+        if (elem.first == 0) { continue; } // not used slot
+        auto itr = wp_key_range_.find(elem.second);
+        if (itr != wp_key_range_.end()) {
+            // check intersection
+            if (r_end != scan_endpoint::INF &&
+                r_key < std::get<0>(itr->second)) {
+                continue;
+            }
+            if (l_end != scan_endpoint::INF &&
+                std::get<1>(itr->second) < l_key) {
+                continue;
+            }
+        }
+        if (min_ep == 0 || elem.first < min_ep) { min_ep = elem.first; }
+    }
+    return min_ep;
+}
+
 } // namespace shirakami::wp
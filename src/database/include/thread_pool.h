@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 #include "thread_task.h"
@@ -41,7 +43,11 @@ public:
      */
     static void fin() {
         // set flag
-        set_running(false);
+        {
+            std::lock_guard<std::mutex> lk{mtx_idle_};
+            set_running(false);
+        }
+        cv_idle_.notify_all();
 
         // join worker thread
         for (std::size_t i = 0; i < get_thread_pool_size(); ++i) {
@@ -54,7 +60,11 @@ public:
      */
     static void worker(std::size_t worker_id);
 
-    static void push_task_queue(thread_task* tt) { task_queue_.push(tt); }
+    static void push_task_queue(thread_task* tt) {
+        task_queue_.push(tt);
+        { std::lock_guard<std::mutex> lk{mtx_idle_}; }
+        cv_idle_.notify_one();
+    }
 
     // getter
     static bool get_running() {
@@ -69,14 +79,22 @@ public:
         return task_queue_;
     }
 
+    static std::size_t get_thread_pool_size() { return thread_pool_size_; }
+
     // setter
     static void set_running(bool tf) {
         running_.store(tf, std::memory_order_release);
     }
 
+    /**
+     * @brief wait for a task while the queue is empty.
+     */
+    static void wait_task() {
+        std::unique_lock<std::mutex> lk{mtx_idle_};
+        cv_idle_.wait(lk, [] { return !get_running() || !task_queue_.empty(); });
+    }
+
 private:
-    // getter
-    static std::size_t get_thread_pool_size() { return thread_pool_size_; }
 
     // setter
     static void set_thread_pool_size(std::size_t sz) { thread_pool_size_ = sz; }
@@ -100,6 +118,16 @@ private:
      * @brief task container
      */
     static inline concurrent_queue<thread_task*> task_queue_; // NOLINT
+
+    /**
+     * @brief mutex for idle workers.
+     */
+    static inline std::mutex mtx_idle_; // NOLINT
+
+    /**
+     * @brief condition variable to wake up idle workers.
+     */
+    static inline std::condition_variable cv_idle_; // NOLINT
 };
 
 } // namespace shirakami
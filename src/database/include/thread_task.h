@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
+#include <utility>
 
 #include "shirakami/scheme.h"
 
@@ -12,6 +14,10 @@ namespace shirakami {
 enum class task_kind : std::int32_t {
     UNKNOWN,
     LTX_COMMIT_WHOLE,
+    /**
+     * @brief expose a part of the write set of ltx at commit.
+     */
+    LTX_EXPOSE_LOCAL_WRITE,
 };
 
 class thread_task {
@@ -25,11 +31,23 @@ public:
         return completed_.load(std::memory_order_acquire);
     }
 
+    [[nodiscard]] std::function<void()> const& get_body() const {
+        return body_;
+    }
+
+    [[nodiscard]] bool get_released_by_pool() const {
+        return released_by_pool_;
+    }
+
     // setter
     void set_task_kind(task_kind tk) { task_kind_ = tk; }
 
     void set_token(Token token) { token_ = token; }
 
+    void set_body(std::function<void()> body) { body_ = std::move(body); }
+
+    void set_released_by_pool(bool tf) { released_by_pool_ = tf; }
+
     void set_completed(bool tf) {
         completed_.store(tf, std::memory_order_release);
     }
@@ -39,7 +57,18 @@ private:
 
     Token token_{};
 
+    /**
+     * @brief the process of this task.
+     */
+    std::function<void()> body_{};
+
     std::atomic<bool> completed_{false};
+
+    /**
+     * @brief whether the thread pool deletes this after the process. If it is
+     * false, the owner waits for @a completed_ and releases this.
+     */
+    bool released_by_pool_{false};
 };
 
 } // namespace shirakami
@@ -7,11 +7,24 @@
 #include "concurrent_queue.h"
 
 namespace shirakami {
-class thread_task;
 
-static void do_task([[maybe_unused]] thread_task* const out_task) {
-    // todo task
-    LOG(INFO);
+static void do_task(thread_task* const out_task) {
+    switch (out_task->get_task_kind()) {
+        case task_kind::LTX_EXPOSE_LOCAL_WRITE: {
+            out_task->get_body()();
+            break;
+        }
+        default: {
+            LOG_FIRST_N(ERROR, 1) << "unsupported task kind.";
+            break;
+        }
+    }
+    if (out_task->get_released_by_pool()) {
+        delete out_task; // NOLINT
+        return;
+    }
+    // the owner of the task may release it after this
+    out_task->set_completed(true);
 }
 
 void thread_pool::worker([[maybe_unused]] std::size_t const worker_id) {
@@ -24,7 +37,7 @@ void thread_pool::worker([[maybe_unused]] std::size_t const worker_id) {
             do_task(out_task);
         } else {
             // else sleep
-            _mm_pause();
+            wait_task();
         }
 
         // check flags and queue
@@ -162,6 +162,10 @@ void flush_log(Token token) {
     }
 }
 
+void add_entry_keep_session(handler& handle) {
+    if (!handle.get_logs().empty()) { add_entry_from_logs(handle); }
+}
+
 void flush_remaining_log() {
     for (auto&& es : session_table::get_session_table()) {
         auto& handle = es.get_lpwal_handle();
@@ -8,6 +8,7 @@
 #include <shared_mutex>
 #include <unordered_map>
 
+#include "shirakami/api_storage.h"
 #include "shirakami/scheme.h"
 #include "shirakami/storage_options.h"
 
@@ -173,8 +174,24 @@ public:
     /**
      * @brief delete storage
      * @param[in] storage
+     * @param[in] async If this is true, the index tree of the storage is
+     * detached and handed to gc, and the records are released in the
+     * background instead of being released inline.
      */
-    static Status delete_storage(Storage storage);
+    static Status delete_storage(Storage storage, bool async = false);
+
+    /**
+     * @brief remove all the records of the storage.
+     * @details It moves the root of the index tree of the storage to a tree
+     * with an internal name and hands that tree to gc, so it doesn't visit the
+     * records. The cleaner releases the records in the background.
+     * @param[in] storage
+     * @return Status::OK success.
+     * @return Status::WARN_INVALID_HANDLE @a storage is not found or is for
+     * internal use.
+     * @return Status::ERR_FATAL Some programming error.
+     */
+    static Status truncate_storage(Storage storage);
 
     static std::shared_mutex& get_mtx_key_handle_map() {
         return mtx_key_handle_map_;
@@ -203,6 +220,38 @@ public:
         strg_ctr_.store(st, std::memory_order_release);
     }
 
+    static void merge_operator_map_clear() {
+        std::lock_guard<std::shared_mutex> lk{mtx_merge_operator_map_};
+        merge_operator_map_.clear();
+    }
+
+    static void merge_operator_map_erase(Storage const st) {
+        std::lock_guard<std::shared_mutex> lk{mtx_merge_operator_map_};
+        merge_operator_map_.erase(st);
+    }
+
+    /**
+     * @brief Get the merge operator of the storage.
+     * @param[in] st The target storage.
+     * @param[out] out The merge operator.
+     * @return Status::OK success.
+     * @return Status::WARN_NOT_FOUND It is not registered.
+     */
+    static Status merge_operator_map_get(Storage const st,
+                                         merge_operator_type& out) {
+        std::shared_lock<std::shared_mutex> lk{mtx_merge_operator_map_};
+        auto itr = merge_operator_map_.find(st);
+        if (itr == merge_operator_map_.end()) { return Status::WARN_NOT_FOUND; }
+        out = itr->second;
+        return Status::OK;
+    }
+
+    static void merge_operator_map_set(Storage const st,
+                                       merge_operator_type op) {
+        std::lock_guard<std::shared_mutex> lk{mtx_merge_operator_map_};
+        merge_operator_map_[st] = std::move(op);
+    }
+
 private:
     static void get_new_storage_num(Storage& storage);
 
@@ -223,6 +272,19 @@ private:
      * @brief Mutex for key handle map.
      */
     static inline std::shared_mutex mtx_key_handle_map_; // NOLINT
+
+    /**
+     * @brief merge operator map
+     * @details key is storage id. value is the merge operator registered by
+     * register_merge_operator.
+     */
+    static inline std::unordered_map<Storage, merge_operator_type> // NOLINT
+            merge_operator_map_;                                   // NOLINT
+
+    /**
+     * @brief Mutex for merge operator map.
+     */
+    static inline std::shared_mutex mtx_merge_operator_map_; // NOLINT
 };
 
 } // namespace shirakami
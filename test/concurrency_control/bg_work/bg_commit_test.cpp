@@ -1,4 +1,5 @@
 
+#include <chrono>
 #include <mutex>
 #include <cstddef>
 #include <memory>
@@ -10,6 +11,7 @@
 #include "glog/logging.h"
 #include "shirakami/database_options.h"
 #include "shirakami/scheme.h"
+#include "test_tool.h"
 
 namespace shirakami::testing {
 
@@ -45,4 +47,56 @@ TEST_F(bg_commit_test, print_out_object) { // NOLINT
     ASSERT_EQ(bg_work::bg_commit::joined_waiting_resolver_threads(), wrtnum);
 }
 
+TEST_F(bg_commit_test, waiting_ltx_resolved_by_finish) { // NOLINT
+    // long epoch time not to resolve by periodic retry
+    database_options options{};
+    constexpr std::size_t epoch_time_us{500000};
+    options.set_epoch_time(epoch_time_us);
+    init(options);
+
+    Storage stx{};
+    Storage sty{};
+    ASSERT_OK(create_storage("x", stx));
+    ASSERT_OK(create_storage("y", sty));
+    Token s1{};
+    Token s2{};
+    ASSERT_OK(enter(s1));
+    ASSERT_OK(enter(s2));
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, stx, "x", "0"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::LONG,
+                        {stx}}));
+    ASSERT_OK(tx_begin({s2, transaction_options::transaction_type::LONG,
+                        {sty}}));
+    ltx_begin_wait(s1);
+    ltx_begin_wait(s2);
+
+    // s2 reads x before s1 writes it, so s2 waits for s1
+    std::string vb{};
+    ASSERT_OK(search_key(s2, stx, "x", vb));
+    ASSERT_OK(upsert(s2, sty, "y", "2"));
+    ASSERT_EQ(Status::WARN_WAITING_FOR_OTHER_TX, commit(s2)); // NOLINT
+
+    ASSERT_OK(upsert(s1, stx, "x", "1"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    // s2 is resolved by s1 finish, not by the next retry
+    auto start = std::chrono::steady_clock::now();
+    Status rc{};
+    while ((rc = check_commit(s2)) == Status::WARN_WAITING_FOR_OTHER_TX) {
+        _mm_pause();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_OK(rc);
+    ASSERT_LT(std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                      .count(),
+              epoch_time_us / 2);
+
+    ASSERT_OK(leave(s1));
+    ASSERT_OK(leave(s2));
+    fin();
+}
+
 } // namespace shirakami::testing
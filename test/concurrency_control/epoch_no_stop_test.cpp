@@ -1,4 +1,5 @@
 
+#include <chrono>
 #include <mutex>
 
 #include "clock.h"
@@ -72,4 +73,29 @@ TEST_F(epoch_no_stop_test, check_not_progress_of_short_expose_ongoing_target_epo
     ASSERT_EQ(Status::OK, leave(s));
 }
 
+TEST_F(epoch_no_stop_test, expedite_ltx_start) { // NOLINT
+    // long epoch time not to start by the periodic epoch update
+    fin();
+    database_options options{};
+    constexpr std::size_t epoch_time_us{1000000};
+    options.set_epoch_time(epoch_time_us);
+    init(options); // NOLINT
+    session::optflag_expedite_ltx_start = true;
+
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::LONG}));
+    auto* ti{static_cast<session*>(s)};
+    while (epoch::get_global_epoch() < ti->get_valid_epoch()) { _mm_pause(); }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_LT(std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                      .count(),
+              epoch_time_us / 2);
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    ASSERT_EQ(Status::OK, leave(s));
+    session::optflag_expedite_ltx_start = false;
+}
+
 } // namespace shirakami::testing
@@ -0,0 +1,90 @@
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "shirakami/interface.h"
+
+#include "test_tool.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class wp_footprint_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-hybrid-"
+                                  "wp_key_range-wp_footprint_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google; // NOLINT
+};
+
+TEST_F(wp_footprint_test, dry_run_footprint_is_applied) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    ASSERT_EQ(Status::OK, enter(s1));
+    Token s2{};
+    ASSERT_EQ(Status::OK, enter(s2));
+
+    // dry run with the whole storage
+    transaction_options options{s1, transaction_options::transaction_type::LONG,
+                                {st}};
+    options.set_label("batch");
+    ASSERT_EQ(tx_begin(options), Status::OK);
+    ltx_begin_wait(s1);
+    ASSERT_EQ(upsert(s1, st, "c", "v"), Status::OK);
+    ASSERT_EQ(upsert(s1, st, "b", "v"), Status::OK);
+    ASSERT_EQ(Status::OK, abort(s1));
+
+    transaction_options::write_preserve_range_type wpr{};
+    ASSERT_EQ(get_write_footprint("batch", wpr), Status::OK);
+    ASSERT_EQ(wpr.size(), 1U);
+    ASSERT_EQ(wpr.at(0), std::make_tuple(st, std::string("b"),
+                                         std::string("c")));
+
+    // the next run preserves only the footprint
+    transaction_options next{s1, transaction_options::transaction_type::LONG};
+    next.set_label("batch");
+    ASSERT_EQ(apply_write_footprint(next), Status::OK);
+    ASSERT_EQ(tx_begin(next), Status::OK);
+    ltx_begin_wait(s1);
+
+    // short tx out of the footprint doesn't conflict
+    ASSERT_EQ(Status::OK,
+              tx_begin({s2, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(upsert(s2, st, "a", "v"), Status::OK);
+    ASSERT_EQ(Status::OK, commit(s2));
+
+    // write out of the footprint is recorded for the next run
+    ASSERT_EQ(upsert(s1, st, "d", "v"), Status::WARN_WRITE_WITHOUT_WP);
+    ASSERT_EQ(upsert(s1, st, "b", "w"), Status::OK);
+    ASSERT_EQ(Status::OK, commit(s1));
+    ASSERT_EQ(get_write_footprint("batch", wpr), Status::OK);
+    ASSERT_EQ(wpr.at(0), std::make_tuple(st, std::string("b"),
+                                         std::string("d")));
+
+    // clear
+    ASSERT_EQ(clear_write_footprint("batch"), Status::OK);
+    ASSERT_EQ(get_write_footprint("batch", wpr), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(apply_write_footprint(next), Status::WARN_NOT_FOUND);
+
+    ASSERT_EQ(Status::OK, leave(s2));
+    ASSERT_EQ(Status::OK, leave(s1));
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,112 @@
+#include <mutex>
+#include <string>
+
+#include "shirakami/interface.h"
+
+#include "test_tool.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class wp_key_range_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-hybrid-"
+                                  "wp_key_range-wp_key_range_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google; // NOLINT
+};
+
+TEST_F(wp_key_range_test, short_out_of_range_does_not_conflict) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    ASSERT_EQ(Status::OK, enter(s1));
+    Token s2{};
+    ASSERT_EQ(Status::OK, enter(s2));
+    transaction_options options{s1,
+                                transaction_options::transaction_type::LONG};
+    options.set_write_preserve_range({{st, "b", "d"}});
+    ASSERT_EQ(tx_begin(options), Status::OK);
+    wait_epoch_update();
+
+    // short tx out of the range
+    ASSERT_EQ(Status::OK,
+              tx_begin({s2, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(insert(s2, st, "a", "v"), Status::OK);
+    ASSERT_EQ(insert(s2, st, "e", "v"), Status::OK);
+    std::string vb{};
+    ASSERT_EQ(search_key(s2, st, "a", vb), Status::OK);
+    ASSERT_EQ(Status::OK, commit(s2));
+
+    // short tx in the range
+    ASSERT_EQ(Status::OK,
+              tx_begin({s2, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(insert(s2, st, "c", "v"),
+              Status::WARN_CONFLICT_ON_WRITE_PRESERVE);
+    ASSERT_EQ(search_key(s2, st, "b", vb), Status::ERR_CC);
+
+    // long tx
+    ASSERT_EQ(upsert(s1, st, "e", "v"), Status::WARN_WRITE_WITHOUT_WP);
+    ASSERT_EQ(upsert(s1, st, "c", "v"), Status::OK);
+    ASSERT_EQ(Status::OK, commit(s1));
+
+    ASSERT_EQ(Status::OK, leave(s2));
+    ASSERT_EQ(Status::OK, leave(s1));
+}
+
+TEST_F(wp_key_range_test, short_scan_in_range_conflicts) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    ASSERT_EQ(Status::OK, enter(s1));
+    Token s2{};
+    ASSERT_EQ(Status::OK, enter(s2));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s2, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(upsert(s2, st, "a", "v"), Status::OK);
+    ASSERT_EQ(upsert(s2, st, "x", "v"), Status::OK);
+    ASSERT_EQ(Status::OK, commit(s2));
+
+    transaction_options options{s1,
+                                transaction_options::transaction_type::LONG};
+    options.set_write_preserve_range({{st, "b", "d"}});
+    ASSERT_EQ(tx_begin(options), Status::OK);
+    wait_epoch_update();
+
+    // scan out of the range
+    ASSERT_EQ(Status::OK,
+              tx_begin({s2, transaction_options::transaction_type::SHORT}));
+    ScanHandle hd{};
+    ASSERT_EQ(Status::OK, open_scan(s2, st, "e", scan_endpoint::INCLUSIVE, "",
+                                    scan_endpoint::INF, hd));
+    ASSERT_EQ(Status::OK, close_scan(s2, hd));
+    ASSERT_EQ(Status::OK, commit(s2));
+
+    // scan including the range
+    ASSERT_EQ(Status::OK,
+              tx_begin({s2, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::ERR_CC, open_scan(s2, st, "", scan_endpoint::INF, "",
+                                        scan_endpoint::INF, hd));
+
+    ASSERT_EQ(Status::OK, commit(s1));
+    ASSERT_EQ(Status::OK, leave(s2));
+    ASSERT_EQ(Status::OK, leave(s1));
+}
+
+} // namespace shirakami::testing
@@ -59,8 +59,8 @@ TEST_F(read_area_test, register_same_st) { // NOLINT
         std::shared_lock<std::shared_mutex> lk{read_plan::get_mtx_cont()};
         ASSERT_EQ(read_plan::get_cont().size(), 1);
         auto ra = *read_plan::get_cont().begin();
-        ASSERT_EQ(std::get<0>(ra.second).size(), 1);
-        ASSERT_EQ(std::get<1>(ra.second).size(), 1);
+        ASSERT_EQ(ra.second.pstorages_.size(), 1);
+        ASSERT_EQ(ra.second.nstorages_.size(), 1);
     }
 
     // check local worker info
@@ -96,8 +96,8 @@ TEST_F(read_area_test, register_and_remove_posi_only_commit) { // NOLINT
         std::shared_lock<std::shared_mutex> lk{read_plan::get_mtx_cont()};
         ASSERT_EQ(read_plan::get_cont().size(), 1);
         auto ra = *read_plan::get_cont().begin();
-        ASSERT_EQ(std::get<0>(ra.second).size(), 1);
-        ASSERT_EQ(std::get<1>(ra.second).size(), 0);
+        ASSERT_EQ(ra.second.pstorages_.size(), 1);
+        ASSERT_EQ(ra.second.nstorages_.size(), 0);
     }
 
     // commit erase above info
@@ -129,8 +129,8 @@ TEST_F(read_area_test, register_and_remove_nega_only_commit) { // NOLINT
         std::shared_lock<std::shared_mutex> lk{read_plan::get_mtx_cont()};
         ASSERT_EQ(read_plan::get_cont().size(), 1);
         auto ra = *read_plan::get_cont().begin();
-        ASSERT_EQ(std::get<0>(ra.second).size(), 0);
-        ASSERT_EQ(std::get<1>(ra.second).size(), 1);
+        ASSERT_EQ(ra.second.pstorages_.size(), 0);
+        ASSERT_EQ(ra.second.nstorages_.size(), 1);
     }
 
     // commit erase above info
@@ -161,8 +161,8 @@ TEST_F(read_area_test, register_and_remove_posi_only_abort) { // NOLINT
         std::shared_lock<std::shared_mutex> lk{read_plan::get_mtx_cont()};
         ASSERT_EQ(read_plan::get_cont().size(), 1);
         auto ra = *read_plan::get_cont().begin();
-        ASSERT_EQ(std::get<0>(ra.second).size(), 1);
-        ASSERT_EQ(std::get<1>(ra.second).size(), 0);
+        ASSERT_EQ(ra.second.pstorages_.size(), 1);
+        ASSERT_EQ(ra.second.nstorages_.size(), 0);
     }
 
     // commit erase above info
@@ -194,8 +194,8 @@ TEST_F(read_area_test, register_and_remove_nega_only_abort) { // NOLINT
         std::shared_lock<std::shared_mutex> lk{read_plan::get_mtx_cont()};
         ASSERT_EQ(read_plan::get_cont().size(), 1);
         auto ra = *read_plan::get_cont().begin();
-        ASSERT_EQ(std::get<0>(ra.second).size(), 0);
-        ASSERT_EQ(std::get<1>(ra.second).size(), 1);
+        ASSERT_EQ(ra.second.pstorages_.size(), 0);
+        ASSERT_EQ(ra.second.nstorages_.size(), 1);
     }
 
     // commit erase above info
@@ -234,8 +234,8 @@ TEST_F(read_area_test, conflict_positive_negative) { // NOLINT
         std::shared_lock<std::shared_mutex> lk{read_plan::get_mtx_cont()};
         ASSERT_EQ(read_plan::get_cont().size(), 1);
         auto ra = *read_plan::get_cont().begin();
-        ASSERT_EQ(std::get<0>(ra.second).size(), 1);
-        ASSERT_EQ(std::get<1>(ra.second).size(), 2);
+        ASSERT_EQ(ra.second.pstorages_.size(), 1);
+        ASSERT_EQ(ra.second.nstorages_.size(), 2);
     }
 
     // check local worker info
@@ -377,4 +377,31 @@ TEST_F(read_area_test, ut_check_range_overlap) {
     EXPECT_FALSE(read_plan::check_range_overlap("3", "5", "", scan_endpoint::INF, "3", scan_endpoint::EXCLUSIVE));
 }
 
+TEST_F(read_area_test, compile_read_plan) { // NOLINT
+    read_plan::plist_type pl{};
+    pl.insert(std::make_tuple(3, false, "", scan_endpoint::EXCLUSIVE, "",
+                              scan_endpoint::EXCLUSIVE));
+    pl.insert(std::make_tuple(1, true, "a", scan_endpoint::INCLUSIVE, "c",
+                              scan_endpoint::EXCLUSIVE));
+    pl.insert(std::make_tuple(1, true, "x", scan_endpoint::INCLUSIVE, "",
+                              scan_endpoint::INF));
+    read_plan::nlist_type nl{5, 2};
+    auto cp = read_plan::compile(pl, nl);
+
+    // storages read as a whole and key ranges are split and sorted
+    ASSERT_EQ(cp.pstorages_, std::vector<Storage>({3}));
+    ASSERT_EQ(cp.pranges_.size(), 2);
+    ASSERT_EQ(std::get<0>(cp.pranges_.at(0)), 1);
+    ASSERT_EQ(std::get<1>(cp.pranges_.at(0)), "a");
+    ASSERT_EQ(std::get<1>(cp.pranges_.at(1)), "x");
+    ASSERT_EQ(cp.nstorages_, std::vector<Storage>({2, 5}));
+
+    // filter has the positive storages
+    ASSERT_NE(cp.pmask_ & read_plan::storage_bit(1), 0);
+    ASSERT_NE(cp.pmask_ & read_plan::storage_bit(3), 0);
+
+    // empty plist has no filter
+    ASSERT_EQ(read_plan::compile({}, nl).pmask_, 0);
+}
+
 } // namespace shirakami::testing
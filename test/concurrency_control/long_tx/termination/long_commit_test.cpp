@@ -80,4 +80,33 @@ TEST_F(long_commit_test, commit_long_long_high_low) { // NOLINT
     ASSERT_EQ(Status::OK, leave(s2));
 }
 
+TEST_F(long_commit_test, commit_large_write_set) { // NOLINT
+    // large enough to expose the write set by the thread pool
+    Storage st{};
+    ASSERT_OK(create_storage("", st));
+    Token s{};
+    ASSERT_OK(enter(s));
+    ASSERT_OK(tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s, st, "0", "old"));
+    ASSERT_OK(commit(s)); // NOLINT
+
+    ASSERT_OK(tx_begin({s, transaction_options::transaction_type::LONG, {st}}));
+    ltx_begin_wait(s);
+    constexpr std::size_t n{50000};
+    for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_OK(upsert(s, st, std::to_string(i), std::to_string(i)));
+    }
+    ASSERT_OK(commit(s)); // NOLINT
+
+    // verify
+    ASSERT_OK(tx_begin({s, transaction_options::transaction_type::SHORT}));
+    std::string vb{};
+    for (std::size_t i = 0; i < n; i += 7) { // NOLINT
+        ASSERT_OK(search_key(s, st, std::to_string(i), vb));
+        ASSERT_EQ(vb, std::to_string(i));
+    }
+    ASSERT_OK(commit(s)); // NOLINT
+    ASSERT_OK(leave(s));
+}
+
 } // namespace shirakami::testing
@@ -57,4 +57,22 @@ TEST_F(ongoing_tx_test, exist_id_test) { // NOLINT
     ASSERT_EQ(ongoing_tx::exist_id(1), false);
 }
 
+TEST_F(ongoing_tx_test, ordered_by_id_test) { // NOLINT
+    ongoing_tx::push({1, 3, nullptr});
+    ongoing_tx::push({1, 1, nullptr});
+    ongoing_tx::push({1, 2, nullptr});
+    ASSERT_EQ(ongoing_tx::get_tx_info().size(), 3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        ASSERT_EQ(std::get<ongoing_tx::index_id>(ongoing_tx::get_tx_info()[i]),
+                  i + 1);
+    }
+    ongoing_tx::remove_id(2);
+    ASSERT_EQ(ongoing_tx::exist_id(1), true);
+    ASSERT_EQ(ongoing_tx::exist_id(2), false);
+    ASSERT_EQ(ongoing_tx::exist_id(3), true);
+    ongoing_tx::remove_id(1);
+    ongoing_tx::remove_id(3);
+    ASSERT_EQ(ongoing_tx::get_tx_info().empty(), true);
+}
+
 } // namespace shirakami::testing
@@ -0,0 +1,110 @@
+#include <mutex>
+
+#include "concurrency_control/include/epoch.h"
+#include "concurrency_control/include/read_by.h"
+#include "concurrency_control/include/session.h"
+
+#include "shirakami/interface.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class point_read_by_long_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-"
+                                  "point_read_by_long_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google; // NOLINT
+};
+
+TEST_F(point_read_by_long_test, is_exist) { // NOLINT
+    point_read_by_long prbl{};
+    // future epoch not to be gced
+    auto ep = epoch::get_global_epoch() + 100; // NOLINT
+    prbl.push({ep, 3});
+    prbl.push({ep + 1, 1});
+
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+    auto* ti = static_cast<session*>(s);
+
+    // only higher priority ltx
+    ti->set_long_tx_id(1);
+    ti->set_valid_epoch(ep);
+    ASSERT_FALSE(prbl.is_exist(s));
+    ti->set_long_tx_id(2);
+    ASSERT_TRUE(prbl.is_exist(s));
+
+    // only the same or later epoch
+    ti->set_valid_epoch(ep + 1);
+    ASSERT_TRUE(prbl.is_exist(s));
+    ti->set_valid_epoch(ep + 2);
+    ASSERT_FALSE(prbl.is_exist(s));
+    ti->set_long_tx_id(4);
+    ti->set_valid_epoch(ep + 1);
+    ASSERT_TRUE(prbl.is_exist(s));
+
+    ti->set_long_tx_id(0);
+    ti->set_valid_epoch(0);
+    ASSERT_EQ(Status::OK, leave(s));
+}
+
+TEST_F(point_read_by_long_test, overflow) { // NOLINT
+    point_read_by_long prbl{};
+    auto ep = epoch::get_global_epoch() + 100; // NOLINT
+    // more than capacity
+    for (std::size_t i = 1; i <= point_read_by_long::capacity + 2; ++i) {
+        prbl.push({ep + i, i * 2});
+    }
+
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+    auto* ti = static_cast<session*>(s);
+
+    // entries are kept exactly, not merged
+    ti->set_long_tx_id(3);
+    ti->set_valid_epoch(ep + 1);
+    ASSERT_TRUE(prbl.is_exist(s));
+    ti->set_valid_epoch(ep + 2);
+    ASSERT_FALSE(prbl.is_exist(s));
+    ti->set_long_tx_id(5);
+    ASSERT_TRUE(prbl.is_exist(s));
+    // entries in the overflow
+    ti->set_long_tx_id(point_read_by_long::capacity * 2 + 3);
+    ti->set_valid_epoch(ep + point_read_by_long::capacity + 1);
+    ASSERT_TRUE(prbl.is_exist(s));
+    ti->set_valid_epoch(ep + point_read_by_long::capacity + 2);
+    ASSERT_FALSE(prbl.is_exist(s));
+    // the lowest priority entry is kept
+    ti->set_long_tx_id((point_read_by_long::capacity + 2) * 2 + 1);
+    ti->set_valid_epoch(ep + point_read_by_long::capacity + 2);
+    ASSERT_TRUE(prbl.is_exist(s));
+    ti->set_valid_epoch(ep + point_read_by_long::capacity + 3);
+    ASSERT_FALSE(prbl.is_exist(s));
+    // the highest priority ltx sees nothing
+    ti->set_long_tx_id(1);
+    ti->set_valid_epoch(ep);
+    ASSERT_FALSE(prbl.is_exist(s));
+
+    ti->set_long_tx_id(0);
+    ti->set_valid_epoch(0);
+    ASSERT_EQ(Status::OK, leave(s));
+}
+
+} // namespace shirakami::testing
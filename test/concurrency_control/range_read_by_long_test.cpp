@@ -0,0 +1,65 @@
+
+#include <mutex>
+
+#include "concurrency_control/include/epoch.h"
+#include "concurrency_control/include/read_by.h"
+
+#include "shirakami/interface.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class range_read_by_long_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-"
+                                  "range_read_by_long_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google; // NOLINT
+};
+
+TEST_F(range_read_by_long_test, is_exist) { // NOLINT
+    range_read_by_long rrbl{};
+    // future epoch not to be gced
+    auto ep = epoch::get_global_epoch() + 100; // NOLINT
+    rrbl.push({ep, 1, "b", scan_endpoint::INCLUSIVE, "d",
+               scan_endpoint::EXCLUSIVE});
+    rrbl.push({ep, 2, "", scan_endpoint::INF, "a", scan_endpoint::INCLUSIVE});
+    rrbl.push({ep, 3, "x", scan_endpoint::EXCLUSIVE, "", scan_endpoint::INF});
+    rrbl.push({ep + 1, 4, "", scan_endpoint::INF, "", scan_endpoint::INF});
+
+    // by the key
+    ASSERT_TRUE(rrbl.is_exist(ep, 10, "b"));  // NOLINT
+    ASSERT_TRUE(rrbl.is_exist(ep, 10, "c"));  // NOLINT
+    ASSERT_FALSE(rrbl.is_exist(ep, 10, "d")); // NOLINT
+    ASSERT_TRUE(rrbl.is_exist(ep, 10, ""));   // NOLINT
+    ASSERT_TRUE(rrbl.is_exist(ep, 10, "a"));  // NOLINT
+    ASSERT_FALSE(rrbl.is_exist(ep, 10, "m")); // NOLINT
+    ASSERT_FALSE(rrbl.is_exist(ep, 10, "x")); // NOLINT
+    ASSERT_TRUE(rrbl.is_exist(ep, 10, "y"));  // NOLINT
+
+    // only higher priority ltx
+    ASSERT_FALSE(rrbl.is_exist(ep, 1, "c")); // NOLINT
+    ASSERT_TRUE(rrbl.is_exist(ep, 2, "c"));  // NOLINT
+
+    // only the same epoch
+    ASSERT_FALSE(rrbl.is_exist(ep + 2, 10, "c")); // NOLINT
+    ASSERT_TRUE(rrbl.is_exist(ep + 1, 10, "m"));  // NOLINT
+}
+
+} // namespace shirakami::testing
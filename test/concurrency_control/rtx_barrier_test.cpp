@@ -0,0 +1,92 @@
+#include <atomic>
+#include <mutex>
+
+#include "concurrency_control/include/epoch.h"
+
+#include "shirakami/interface.h"
+
+#include "test_tool.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class rtx_barrier_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-"
+                                  "rtx_barrier_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google; // NOLINT
+};
+
+TEST_F(rtx_barrier_test, read_committed_after_barrier) { // NOLINT
+    Storage st{};
+    ASSERT_OK(create_storage("", st));
+    Token s{};
+    ASSERT_OK(enter(s));
+    ASSERT_OK(tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s, st, "a", "v"));
+    ASSERT_OK(commit(s)); // NOLINT
+
+    rtx_barrier_anchor_type anchor{};
+    ASSERT_OK(acquire_rtx_barrier(anchor));
+    ASSERT_OK(wait_rtx_barrier(anchor));
+    bool released{};
+    ASSERT_OK(check_rtx_barrier(anchor, released));
+    ASSERT_TRUE(released);
+
+    // rtx reads the committed write
+    ASSERT_OK(tx_begin({s, transaction_options::transaction_type::READ_ONLY}));
+    ltx_begin_wait(s);
+    std::string vb{};
+    ASSERT_OK(search_key(s, st, "a", vb));
+    ASSERT_EQ(vb, "v");
+    ASSERT_OK(commit(s)); // NOLINT
+    ASSERT_OK(leave(s));
+}
+
+TEST_F(rtx_barrier_test, wait_for_running_ltx) { // NOLINT
+    Token s{};
+    ASSERT_OK(enter(s));
+    ASSERT_OK(tx_begin({s, transaction_options::transaction_type::LONG}));
+    ltx_begin_wait(s);
+
+    rtx_barrier_anchor_type anchor{};
+    ASSERT_OK(acquire_rtx_barrier(anchor));
+    std::atomic<bool> called{false};
+    ASSERT_OK(wait_rtx_barrier(anchor, [&called](Status st) {
+        EXPECT_EQ(st, Status::OK);
+        called = true;
+    }));
+
+    // the running ltx holds cc_safe_ss_epoch
+    wait_epoch_update();
+    wait_epoch_update();
+    bool released{};
+    ASSERT_OK(check_rtx_barrier(anchor, released));
+    ASSERT_FALSE(released);
+    ASSERT_FALSE(called);
+
+    ASSERT_OK(commit(s)); // NOLINT
+    while (!called) { _mm_pause(); }
+    ASSERT_OK(check_rtx_barrier(anchor, released));
+    ASSERT_TRUE(released);
+    ASSERT_OK(leave(s));
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,159 @@
+#include <mutex>
+#include <string>
+
+#include "shirakami/interface.h"
+
+#include "test_tool.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class shared_snapshot_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-"
+                                  "shared_snapshot_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google; // NOLINT
+};
+
+TEST_F(shared_snapshot_test, rtxs_read_same_snapshot) { // NOLINT
+    Storage st{};
+    ASSERT_OK(create_storage("", st));
+    Token s1{};
+    Token s2{};
+    ASSERT_OK(enter(s1));
+    ASSERT_OK(enter(s2));
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, st, "a", "v1"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    SnapshotHandle sh{};
+    ASSERT_OK(open_snapshot(sh));
+    wait_epoch_update();
+
+    // update after the snapshot
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, st, "a", "v2"));
+    ASSERT_OK(upsert(s1, st, "b", "v2"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    // both rtxs read the snapshot
+    transaction_options to{s1, transaction_options::transaction_type::READ_ONLY};
+    to.set_snapshot(sh);
+    ASSERT_OK(tx_begin(to));
+    to.set_token(s2);
+    ASSERT_OK(tx_begin(to));
+    ltx_begin_wait(s1);
+    ltx_begin_wait(s2);
+    std::string vb{};
+    ASSERT_OK(search_key(s1, st, "a", vb));
+    ASSERT_EQ(vb, "v1");
+    ASSERT_EQ(Status::WARN_NOT_FOUND, search_key(s1, st, "b", vb));
+    // resolved by s1
+    ASSERT_OK(search_key(s2, st, "a", vb));
+    ASSERT_EQ(vb, "v1");
+    ASSERT_EQ(Status::WARN_NOT_FOUND, search_key(s2, st, "b", vb));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    // attached rtx can read after closing
+    ASSERT_OK(close_snapshot(sh));
+    ASSERT_OK(search_key(s2, st, "a", vb));
+    ASSERT_EQ(vb, "v1");
+    ASSERT_OK(commit(s2)); // NOLINT
+
+    // rtx without snapshot reads the latest
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::READ_ONLY}));
+    ltx_begin_wait(s1);
+    ASSERT_OK(search_key(s1, st, "a", vb));
+    ASSERT_EQ(vb, "v2");
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    ASSERT_OK(leave(s1));
+    ASSERT_OK(leave(s2));
+}
+
+TEST_F(shared_snapshot_test, many_records) { // NOLINT
+    Storage st{};
+    ASSERT_OK(create_storage("", st));
+    Token s1{};
+    Token s2{};
+    ASSERT_OK(enter(s1));
+    ASSERT_OK(enter(s2));
+    constexpr std::size_t n = 1000;
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_OK(upsert(s1, st, std::to_string(i), std::to_string(i)));
+    }
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    SnapshotHandle sh{};
+    ASSERT_OK(open_snapshot(sh));
+    wait_epoch_update();
+
+    // update after the snapshot
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_OK(upsert(s1, st, std::to_string(i), "new"));
+    }
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    // s1 fills the cache and s2 reads through it
+    transaction_options to{s1, transaction_options::transaction_type::READ_ONLY};
+    to.set_snapshot(sh);
+    ASSERT_OK(tx_begin(to));
+    to.set_token(s2);
+    ASSERT_OK(tx_begin(to));
+    ltx_begin_wait(s1);
+    ltx_begin_wait(s2);
+    std::string vb{};
+    for (auto* s : {s1, s2}) {
+        for (std::size_t i = 0; i < n; ++i) {
+            ASSERT_OK(search_key(s, st, std::to_string(i), vb));
+            ASSERT_EQ(vb, std::to_string(i));
+        }
+    }
+    ASSERT_OK(commit(s1)); // NOLINT
+    ASSERT_OK(commit(s2)); // NOLINT
+    ASSERT_OK(close_snapshot(sh));
+
+    ASSERT_OK(leave(s1));
+    ASSERT_OK(leave(s2));
+}
+
+TEST_F(shared_snapshot_test, invalid_handle) { // NOLINT
+    Token s{};
+    ASSERT_OK(enter(s));
+    SnapshotHandle sh{};
+    ASSERT_OK(open_snapshot(sh));
+
+    // only rtx can use snapshot
+    transaction_options to{s, transaction_options::transaction_type::SHORT};
+    to.set_snapshot(sh);
+    ASSERT_EQ(Status::WARN_ILLEGAL_OPERATION, tx_begin(to));
+
+    // closed snapshot can't be attached
+    ASSERT_OK(close_snapshot(sh));
+    ASSERT_EQ(Status::WARN_INVALID_HANDLE, close_snapshot(sh));
+    to.set_transaction_type(transaction_options::transaction_type::READ_ONLY);
+    ASSERT_EQ(Status::WARN_INVALID_HANDLE, tx_begin(to));
+
+    ASSERT_OK(leave(s));
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,158 @@
+
+#include <mutex>
+#include <string>
+
+#include "shirakami/interface.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class short_delete_range_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging(
+                "shirakami-test-concurrency_control-short_tx-delete-"
+                "short_delete_range_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google_; // NOLINT
+};
+
+TEST_F(short_delete_range_test, delete_range_basic) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    for (char c = 'a'; c <= 'e'; ++c) {
+        ASSERT_EQ(upsert(s, st, std::string(1, c), "v"), Status::OK);
+    }
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    // delete [b, d) with own writes
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(update(s, st, "b", "w"), Status::OK);
+    ASSERT_EQ(insert(s, st, "bb", "w"), Status::OK);
+    ASSERT_EQ(delete_range(s, st, "b", scan_endpoint::INCLUSIVE, "d",
+                           scan_endpoint::EXCLUSIVE),
+              Status::OK);
+    std::string vb{};
+    ASSERT_EQ(search_key(s, st, "b", vb), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(search_key(s, st, "bb", vb), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    // verify
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(search_key(s, st, "a", vb), Status::OK);
+    ASSERT_EQ(search_key(s, st, "b", vb), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(search_key(s, st, "bb", vb), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(search_key(s, st, "c", vb), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(search_key(s, st, "d", vb), Status::OK);
+    ASSERT_EQ(search_key(s, st, "e", vb), Status::OK);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    // nothing to delete
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(delete_range(s, st, "b", scan_endpoint::INCLUSIVE, "d",
+                           scan_endpoint::EXCLUSIVE),
+              Status::WARN_NOT_FOUND);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_delete_range_test, delete_range_phantom) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    Token s2{};
+    ASSERT_EQ(enter(s1), Status::OK);
+    ASSERT_EQ(enter(s2), Status::OK);
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", "v"), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(delete_range(s1, st, "", scan_endpoint::INF, "",
+                           scan_endpoint::INF),
+              Status::OK);
+
+    // insert into the range concurrently
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(insert(s2, st, "b", "v"), Status::OK);
+    ASSERT_EQ(commit(s2), Status::OK); // NOLINT
+
+    ASSERT_EQ(commit(s1), Status::ERR_CC); // NOLINT
+    ASSERT_EQ(leave(s1), Status::OK);
+    ASSERT_EQ(leave(s2), Status::OK);
+}
+
+TEST_F(short_delete_range_test, delete_range_by_long_tx) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::LONG, {st}}),
+              Status::OK);
+    ASSERT_EQ(delete_range(s, st, "", scan_endpoint::INF, "",
+                           scan_endpoint::INF),
+              Status::WARN_ILLEGAL_OPERATION);
+    ASSERT_EQ(abort(s), Status::OK);
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_delete_range_test, delete_range_over_wp) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    Token s2{};
+    ASSERT_EQ(enter(s1), Status::OK);
+    ASSERT_EQ(enter(s2), Status::OK);
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", "v"), Status::OK);
+    ASSERT_EQ(upsert(s1, st, "c", "v"), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    // the ltx preserves the middle of the range, not the left end
+    transaction_options options{s2, transaction_options::transaction_type::LONG};
+    options.set_write_preserve_range({{st, "b", "d"}});
+    ASSERT_EQ(tx_begin(options), Status::OK);
+
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(delete_range(s1, st, "a", scan_endpoint::INCLUSIVE, "z",
+                           scan_endpoint::INCLUSIVE),
+              Status::WARN_CONFLICT_ON_WRITE_PRESERVE);
+    // out of the preserve
+    ASSERT_EQ(delete_range(s1, st, "", scan_endpoint::INF, "a",
+                           scan_endpoint::INCLUSIVE),
+              Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    ASSERT_EQ(abort(s2), Status::OK);
+    ASSERT_EQ(leave(s1), Status::OK);
+    ASSERT_EQ(leave(s2), Status::OK);
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,219 @@
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "concurrency_control/include/session.h"
+
+#include "shirakami/interface.h"
+
+#include "test_tool.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class short_merge_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging(
+                "shirakami-test-concurrency_control-short_tx-rmw-"
+                "short_merge_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+    static std::string to_value(std::int64_t const v) {
+        return {reinterpret_cast<char const*>(&v), sizeof(v)}; // NOLINT
+    }
+
+    static std::int64_t from_value(std::string_view const v) {
+        std::int64_t ret{};
+        memcpy(&ret, v.data(), sizeof(ret));
+        return ret;
+    }
+
+    static void add_operator(std::string_view const existing,
+                             std::string_view const operand,
+                             std::string& out) {
+        out = to_value(from_value(existing) + from_value(operand));
+    }
+
+private:
+    static inline std::once_flag init_google_; // NOLINT
+};
+
+TEST_F(short_merge_test, merge_without_operator) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s, st, "a", to_value(0)), Status::OK);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(merge(s, st, "a", to_value(1)), Status::WARN_INVALID_ARGS);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_merge_test, merge_basic) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    ASSERT_EQ(register_merge_operator(st, add_operator), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+
+    // not found
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(merge(s, st, "a", to_value(1)), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(upsert(s, st, "a", to_value(10)), Status::OK);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    // merge twice without read
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(merge(s, st, "a", to_value(1)), Status::OK);
+    ASSERT_EQ(merge(s, st, "a", to_value(2)), Status::OK);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    // read own merge
+    std::string vb{};
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(merge(s, st, "a", to_value(3)), Status::OK);
+    ASSERT_EQ(search_key(s, st, "a", vb), Status::OK);
+    ASSERT_EQ(from_value(vb), 16);
+    // merge into fixed value
+    ASSERT_EQ(merge(s, st, "a", to_value(4)), Status::OK);
+    ASSERT_EQ(search_key(s, st, "a", vb), Status::OK);
+    ASSERT_EQ(from_value(vb), 20);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    // verify
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(search_key(s, st, "a", vb), Status::OK);
+    ASSERT_EQ(from_value(vb), 20);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_merge_test, merge_by_long_tx) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    ASSERT_EQ(register_merge_operator(st, add_operator), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::LONG, {st}}),
+              Status::OK);
+    ASSERT_EQ(merge(s, st, "a", to_value(1)), Status::WARN_ILLEGAL_OPERATION);
+    ASSERT_EQ(abort(s), Status::OK);
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_merge_test, concurrent_merge) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    ASSERT_EQ(register_merge_operator(st, add_operator), Status::OK);
+    {
+        Token s{};
+        ASSERT_EQ(enter(s), Status::OK);
+        ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+                  Status::OK);
+        ASSERT_EQ(upsert(s, st, "a", to_value(0)), Status::OK);
+        ASSERT_EQ(commit(s), Status::OK); // NOLINT
+        ASSERT_EQ(leave(s), Status::OK);
+    }
+
+    constexpr std::size_t th_num{4};
+    constexpr std::size_t tx_num{100};
+    std::array<std::size_t, th_num> ct_abort{};
+    auto work = [st, &ct_abort](std::size_t const th_id) {
+        Token s{};
+        while (enter(s) != Status::OK) { std::this_thread::yield(); }
+        for (std::size_t i = 0; i < tx_num; ++i) {
+            tx_begin({s, transaction_options::transaction_type::SHORT});
+            merge(s, st, "a", to_value(1));
+            if (commit(s) != Status::OK) { ++ct_abort.at(th_id); } // NOLINT
+        }
+        leave(s);
+    };
+    std::vector<std::thread> ths{};
+    ths.reserve(th_num);
+    for (std::size_t i = 0; i < th_num; ++i) { ths.emplace_back(work, i); }
+    for (auto&& th : ths) { th.join(); }
+
+    // merges don't conflict each other
+    for (auto&& ct : ct_abort) { ASSERT_EQ(ct, 0); }
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    std::string vb{};
+    ASSERT_EQ(search_key(s, st, "a", vb), Status::OK);
+    ASSERT_EQ(from_value(vb), static_cast<std::int64_t>(th_num * tx_num));
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_merge_test, merge_and_ltx_preserve) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    ASSERT_EQ(register_merge_operator(st, add_operator), Status::OK);
+    Token s1{};
+    Token s2{};
+    ASSERT_EQ(enter(s1), Status::OK);
+    ASSERT_EQ(enter(s2), Status::OK);
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", to_value(0)), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    // s1 merges before the ltx preserves the key
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(merge(s1, st, "a", to_value(1)), Status::OK);
+
+    // the ltx is valid before the merge commits
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::LONG, {st}}),
+              Status::OK);
+    ltx_begin_wait(s2);
+    ASSERT_EQ(upsert(s2, st, "a", to_value(10)), Status::OK);
+
+    // the merge read the value which the ltx may overwrite before it
+    ASSERT_EQ(commit(s1), Status::ERR_CC); // NOLINT
+    ASSERT_EQ(static_cast<session*>(s1)->get_result_info().get_reason_code(),
+              reason_code::CC_OCC_WP_VERIFY);
+    ASSERT_EQ(commit(s2), Status::OK); // NOLINT
+
+    // verify
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    std::string vb{};
+    ASSERT_EQ(search_key(s1, st, "a", vb), Status::OK);
+    ASSERT_EQ(from_value(vb), 10);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s1), Status::OK);
+    ASSERT_EQ(leave(s2), Status::OK);
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,106 @@
+
+#include <mutex>
+#include <string>
+
+#include "shirakami/interface.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class short_update_if_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging(
+                "shirakami-test-concurrency_control-short_tx-rmw-"
+                "short_update_if_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google_; // NOLINT
+};
+
+TEST_F(short_update_if_test, update_if_basic) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(update_if(s, st, "a", "A", "B"), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(upsert(s, st, "a", "A"), Status::OK);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    // match
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(update_if(s, st, "a", "A", "B"), Status::OK);
+    ASSERT_EQ(update_if(s, st, "a", "B", "C"),
+              Status::WARN_ILLEGAL_OPERATION);
+    std::string vb{};
+    ASSERT_EQ(search_key(s, st, "a", vb), Status::OK);
+    ASSERT_EQ(vb, "B");
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    // mismatch
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(update_if(s, st, "a", "A", "C"), Status::OK);
+    ASSERT_EQ(commit(s), Status::ERR_KVS); // NOLINT
+    ASSERT_EQ(transaction_result_info(s)->get_reason_code(),
+              reason_code::KVS_UPDATE_IF_MISMATCH);
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_update_if_test, update_if_after_concurrent_update) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    Token s2{};
+    ASSERT_EQ(enter(s1), Status::OK);
+    ASSERT_EQ(enter(s2), Status::OK);
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", "A"), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    // s1 expects A, s2 overwrites by A concurrently
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(update_if(s1, st, "a", "A", "B"), Status::OK);
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(update(s2, st, "a", "A"), Status::OK);
+    ASSERT_EQ(commit(s2), Status::OK); // NOLINT
+    // no read is registered, so it is valid
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    // s1 expects B, s2 overwrites by C concurrently
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(update_if(s1, st, "a", "B", "D"), Status::OK);
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(update(s2, st, "a", "C"), Status::OK);
+    ASSERT_EQ(commit(s2), Status::OK); // NOLINT
+    ASSERT_EQ(commit(s1), Status::ERR_KVS); // NOLINT
+    ASSERT_EQ(transaction_result_info(s1)->get_reason_code(),
+              reason_code::KVS_UPDATE_IF_MISMATCH);
+
+    ASSERT_EQ(leave(s1), Status::OK);
+    ASSERT_EQ(leave(s2), Status::OK);
+}
+
+} // namespace shirakami::testing
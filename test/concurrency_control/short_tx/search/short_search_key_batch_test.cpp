@@ -0,0 +1,193 @@
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "shirakami/interface.h"
+
+#include "test_tool.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class short_search_key_batch_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging(
+                "shirakami-test-concurrency_control-short_tx-search-"
+                "short_search_key_batch_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google_; // NOLINT
+};
+
+TEST_F(short_search_key_batch_test, mixed_results) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    // prepare 40 keys, which is larger than the group of the batch
+    constexpr std::size_t key_num{40};
+    std::vector<std::string> keys(key_num);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    for (std::size_t i = 0; i < key_num; ++i) {
+        keys.at(i) = "k" + std::to_string(i);
+        if (i % 2 == 0) {
+            ASSERT_EQ(upsert(s, st, keys.at(i), "v" + std::to_string(i)),
+                      Status::OK);
+        }
+    }
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    // read own write
+    ASSERT_EQ(upsert(s, st, keys.at(1), "own"), Status::OK);
+    std::vector<std::string_view> key_views(keys.begin(), keys.end());
+    std::vector<std::string> values(key_num);
+    std::vector<Status> statuses(key_num);
+    ASSERT_EQ(search_key_batch(s, st, key_views.data(), values.data(),
+                               statuses.data(), key_num),
+              Status::OK);
+    for (std::size_t i = 0; i < key_num; ++i) {
+        if (i == 1) {
+            ASSERT_EQ(statuses.at(i), Status::OK);
+            ASSERT_EQ(values.at(i), "own");
+        } else if (i % 2 == 0) {
+            ASSERT_EQ(statuses.at(i), Status::OK);
+            ASSERT_EQ(values.at(i), "v" + std::to_string(i));
+        } else {
+            ASSERT_EQ(statuses.at(i), Status::WARN_NOT_FOUND);
+        }
+    }
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_search_key_batch_test, read_is_verified) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    Token s2{};
+    ASSERT_EQ(enter(s1), Status::OK);
+    ASSERT_EQ(enter(s2), Status::OK);
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", "A"), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    std::array<std::string_view, 2> keys{"a", "b"};
+    std::array<std::string, 2> values{};
+    std::array<Status, 2> statuses{};
+    ASSERT_EQ(search_key_batch(s1, st, keys.data(), values.data(),
+                               statuses.data(), keys.size()),
+              Status::OK);
+    ASSERT_EQ(statuses.at(0), Status::OK);
+    ASSERT_EQ(statuses.at(1), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(upsert(s1, st, "c", "C"), Status::OK);
+
+    // overwrite the read record
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s2, st, "a", "B"), Status::OK);
+    ASSERT_EQ(commit(s2), Status::OK); // NOLINT
+
+    ASSERT_EQ(commit(s1), Status::ERR_CC); // NOLINT
+    ASSERT_EQ(leave(s1), Status::OK);
+    ASSERT_EQ(leave(s2), Status::OK);
+}
+
+TEST_F(short_search_key_batch_test, not_begin) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    std::array<std::string_view, 1> keys{"a"};
+    std::array<std::string, 1> values{};
+    std::array<Status, 1> statuses{};
+    ASSERT_EQ(search_key_batch(s, st, keys.data(), values.data(),
+                               statuses.data(), keys.size()),
+              Status::WARN_NOT_BEGIN);
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+TEST_F(short_search_key_batch_test, wp_between_keys) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    Token s2{};
+    ASSERT_EQ(enter(s1), Status::OK);
+    ASSERT_EQ(enter(s2), Status::OK);
+    transaction_options options{s1,
+                                transaction_options::transaction_type::LONG};
+    options.set_write_preserve_range({{st, "b", "d"}});
+    ASSERT_EQ(tx_begin(options), Status::OK);
+    wait_epoch_update();
+
+    // the keys are around the wp but not in it
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    std::array<std::string_view, 2> keys{"a", "e"};
+    std::array<std::string, 2> values{};
+    std::array<Status, 2> statuses{};
+    ASSERT_EQ(search_key_batch(s2, st, keys.data(), values.data(),
+                               statuses.data(), keys.size()),
+              Status::OK);
+    ASSERT_EQ(statuses.at(0), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(statuses.at(1), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(commit(s2), Status::OK); // NOLINT
+
+    // a key in the wp
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    keys.at(1) = "c";
+    ASSERT_EQ(search_key_batch(s2, st, keys.data(), values.data(),
+                               statuses.data(), keys.size()),
+              Status::ERR_CC);
+    ASSERT_EQ(statuses.at(1), Status::ERR_CC);
+
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s1), Status::OK);
+    ASSERT_EQ(leave(s2), Status::OK);
+}
+
+TEST_F(short_search_key_batch_test, empty_and_storage_not_found) { // NOLINT
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    std::array<std::string_view, 2> keys{"a", "b"};
+    std::array<std::string, 2> values{};
+    std::array<Status, 2> statuses{};
+    ASSERT_EQ(search_key_batch(s, 12345, keys.data(), values.data(), // NOLINT
+                               statuses.data(), 0),
+              Status::OK);
+    ASSERT_EQ(search_key_batch(s, 12345, keys.data(), values.data(), // NOLINT
+                               statuses.data(), keys.size()),
+              Status::WARN_STORAGE_NOT_FOUND);
+    ASSERT_EQ(statuses.at(0), Status::WARN_STORAGE_NOT_FOUND);
+    ASSERT_EQ(statuses.at(1), Status::WARN_STORAGE_NOT_FOUND);
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,138 @@
+
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "shirakami/interface.h"
+
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class short_bulk_load_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-short_"
+                                  "tx-storage-short_bulk_load_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+    void SetUp() override {
+        std::call_once(init_google_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google_; // NOLINT
+};
+
+TEST_F(short_bulk_load_test, load_and_search) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, create_storage("", st));
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+
+    // prepare data more than one log batch
+    constexpr std::size_t n{5000};
+    std::vector<std::string> key_buf{};
+    std::vector<std::string> val_buf{};
+    for (std::size_t i = 0; i < n; ++i) {
+        std::string k(8, '\0');
+        for (std::size_t j = 0; j < 8; ++j) {
+            k[7 - j] = static_cast<char>((i >> (j * 8)) & 0xff); // NOLINT
+        }
+        key_buf.emplace_back(k);
+        val_buf.emplace_back(std::to_string(i));
+    }
+    std::vector<std::string_view> keys(key_buf.begin(), key_buf.end());
+    std::vector<std::string_view> vals(val_buf.begin(), val_buf.end());
+
+    ASSERT_EQ(Status::OK, bulk_load(s, st, keys.data(), vals.data(), n));
+
+    // verify
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    std::string vb{};
+    for (std::size_t i = 0; i < n; i += 97) { // NOLINT
+        ASSERT_EQ(Status::OK, search_key(s, st, key_buf[i], vb));
+        ASSERT_EQ(vb, val_buf[i]);
+    }
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    // the records can be updated by usual tx
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, update(s, st, key_buf[0], "v"));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, search_key(s, st, key_buf[0], vb));
+    ASSERT_EQ(vb, "v");
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    ASSERT_EQ(Status::OK, leave(s));
+}
+
+TEST_F(short_bulk_load_test, invalid_input) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, create_storage("", st));
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+
+    // not sorted
+    std::vector<std::string_view> keys{"b", "a"};
+    std::vector<std::string_view> vals{"1", "2"};
+    ASSERT_EQ(Status::WARN_INVALID_ARGS,
+              bulk_load(s, st, keys.data(), vals.data(), keys.size()));
+
+    // duplicate
+    keys = {"a", "a"};
+    ASSERT_EQ(Status::WARN_INVALID_ARGS,
+              bulk_load(s, st, keys.data(), vals.data(), keys.size()));
+
+    // in tx
+    keys = {"a", "b"};
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::WARN_ALREADY_BEGIN,
+              bulk_load(s, st, keys.data(), vals.data(), keys.size()));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    // storage not found
+    ASSERT_EQ(Status::WARN_STORAGE_NOT_FOUND,
+              bulk_load(s, st + 1, keys.data(), vals.data(), keys.size()));
+
+    // nothing was loaded
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    std::string vb{};
+    ASSERT_EQ(Status::WARN_NOT_FOUND, search_key(s, st, "a", vb));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    ASSERT_EQ(Status::OK, leave(s));
+}
+
+TEST_F(short_bulk_load_test, not_empty_storage) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, create_storage("", st));
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, upsert(s, st, "z", ""));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    std::vector<std::string_view> keys{"a", "b"};
+    std::vector<std::string_view> vals{"1", "2"};
+    ASSERT_EQ(Status::WARN_ALREADY_EXISTS,
+              bulk_load(s, st, keys.data(), vals.data(), keys.size()));
+
+    ASSERT_EQ(Status::OK, leave(s));
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,153 @@
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "shirakami/interface.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class short_commit_batch_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-short_tx-"
+                                  "termination-short_commit_batch_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_google_; // NOLINT
+};
+
+TEST_F(short_commit_batch_test, result_for_each_token) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    std::array<Token, 4> tokens{};
+    for (auto&& token : tokens) { ASSERT_EQ(enter(token), Status::OK); }
+
+    // token 0, 1: write different keys
+    ASSERT_EQ(tx_begin({tokens.at(0),
+                        transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(tokens.at(0), st, "a", "A"), Status::OK);
+    ASSERT_EQ(tx_begin({tokens.at(1),
+                        transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(tokens.at(1), st, "b", "B"), Status::OK);
+    // token 2: not begun
+    // token 3: long transaction
+    ASSERT_EQ(tx_begin({tokens.at(3),
+                        transaction_options::transaction_type::LONG,
+                        {st}}),
+              Status::OK);
+
+    std::array<Status, 4> results{};
+    std::vector<std::pair<Token, commit_callback_type>> requests{};
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        requests.emplace_back(tokens.at(i), [&results, i](Status rc, reason_code,
+                                                          durability_marker_type) {
+            results.at(i) = rc;
+        });
+    }
+    commit_batch(requests);
+    ASSERT_EQ(results.at(0), Status::OK);
+    ASSERT_EQ(results.at(1), Status::OK);
+    ASSERT_EQ(results.at(2), Status::WARN_NOT_BEGIN);
+    ASSERT_EQ(results.at(3), Status::WARN_ILLEGAL_OPERATION);
+    ASSERT_EQ(abort(tokens.at(3)), Status::OK);
+
+    // verify
+    std::string vb{};
+    ASSERT_EQ(tx_begin({tokens.at(0),
+                        transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(search_key(tokens.at(0), st, "a", vb), Status::OK);
+    ASSERT_EQ(vb, "A");
+    ASSERT_EQ(search_key(tokens.at(0), st, "b", vb), Status::OK);
+    ASSERT_EQ(vb, "B");
+    ASSERT_EQ(commit(tokens.at(0)), Status::OK); // NOLINT
+
+    for (auto&& token : tokens) { ASSERT_EQ(leave(token), Status::OK); }
+}
+
+TEST_F(short_commit_batch_test, conflict_in_batch) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    std::array<Token, 2> tokens{};
+    for (auto&& token : tokens) { ASSERT_EQ(enter(token), Status::OK); }
+    ASSERT_EQ(tx_begin({tokens.at(0),
+                        transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(tokens.at(0), st, "a", "A"), Status::OK);
+    ASSERT_EQ(commit(tokens.at(0)), Status::OK); // NOLINT
+
+    // both read and write a, the latter fails read verify
+    std::string vb{};
+    for (auto&& token : tokens) {
+        ASSERT_EQ(tx_begin({token, transaction_options::transaction_type::SHORT}),
+                  Status::OK);
+        ASSERT_EQ(search_key(token, st, "a", vb), Status::OK);
+        ASSERT_EQ(update(token, st, "a", "B"), Status::OK);
+    }
+
+    std::array<Status, 2> results{};
+    std::array<reason_code, 2> reasons{};
+    std::vector<std::pair<Token, commit_callback_type>> requests{};
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        requests.emplace_back(tokens.at(i), [&results, &reasons, i](
+                                                    Status rc, reason_code rsn,
+                                                    durability_marker_type) {
+            results.at(i) = rc;
+            reasons.at(i) = rsn;
+        });
+    }
+    commit_batch(requests);
+    ASSERT_EQ(results.at(0), Status::OK);
+    ASSERT_EQ(results.at(1), Status::ERR_CC);
+    ASSERT_EQ(reasons.at(1), reason_code::CC_OCC_READ_VERIFY);
+
+    for (auto&& token : tokens) { ASSERT_EQ(leave(token), Status::OK); }
+}
+
+TEST_F(short_commit_batch_test, duplicated_token) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s{};
+    ASSERT_EQ(enter(s), Status::OK);
+    ASSERT_EQ(tx_begin({s, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s, st, "a", "A"), Status::OK);
+
+    std::array<Status, 2> results{};
+    std::vector<std::pair<Token, commit_callback_type>> requests{};
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        requests.emplace_back(s, [&results, i](Status rc, reason_code,
+                                               durability_marker_type) {
+            results.at(i) = rc;
+        });
+    }
+    commit_batch(requests);
+    ASSERT_EQ(results.at(0), Status::WARN_INVALID_ARGS);
+    ASSERT_EQ(results.at(1), Status::WARN_INVALID_ARGS);
+
+    // the transaction is still running
+    ASSERT_EQ(commit(s), Status::OK); // NOLINT
+    ASSERT_EQ(leave(s), Status::OK);
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,109 @@
+
+#include <mutex>
+#include <string>
+
+#include "concurrency_control/include/session.h"
+
+#include "shirakami/interface.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class short_early_read_verify_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-short_tx-"
+                                  "termination-short_early_read_verify_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override {
+        session::optflag_occ_early_read_verify_interval = 0;
+        fin();
+    }
+
+private:
+    static inline std::once_flag init_google_; // NOLINT
+};
+
+TEST_F(short_early_read_verify_test, abort_at_next_op) { // NOLINT
+    session::optflag_occ_early_read_verify_interval = 1;
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    Token s2{};
+    ASSERT_EQ(enter(s1), Status::OK);
+    ASSERT_EQ(enter(s2), Status::OK);
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", "v"), Status::OK);
+    ASSERT_EQ(upsert(s1, st, "b", "v"), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    // s2 reads a
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    std::string vb{};
+    ASSERT_EQ(search_key(s2, st, "a", vb), Status::OK);
+
+    // s1 overwrites a
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", "w"), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    // s2 is doomed and finds it before commit
+    ASSERT_EQ(search_key(s2, st, "b", vb), Status::ERR_CC);
+    auto& rinfo = static_cast<session*>(s2)->get_result_info();
+    ASSERT_EQ(rinfo.get_reason_code(), reason_code::CC_OCC_READ_VERIFY);
+    ASSERT_EQ(commit(s2), Status::WARN_NOT_BEGIN); // NOLINT
+
+    ASSERT_EQ(leave(s1), Status::OK);
+    ASSERT_EQ(leave(s2), Status::OK);
+}
+
+TEST_F(short_early_read_verify_test, disabled) { // NOLINT
+    session::optflag_occ_early_read_verify_interval = 0;
+    Storage st{};
+    ASSERT_EQ(create_storage("", st), Status::OK);
+    Token s1{};
+    Token s2{};
+    ASSERT_EQ(enter(s1), Status::OK);
+    ASSERT_EQ(enter(s2), Status::OK);
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", "v"), Status::OK);
+    ASSERT_EQ(upsert(s1, st, "b", "v"), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    ASSERT_EQ(tx_begin({s2, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    std::string vb{};
+    ASSERT_EQ(search_key(s2, st, "a", vb), Status::OK);
+
+    ASSERT_EQ(tx_begin({s1, transaction_options::transaction_type::SHORT}),
+              Status::OK);
+    ASSERT_EQ(upsert(s1, st, "a", "w"), Status::OK);
+    ASSERT_EQ(commit(s1), Status::OK); // NOLINT
+
+    // s2 finds it at commit
+    ASSERT_EQ(search_key(s2, st, "b", vb), Status::OK);
+    ASSERT_EQ(commit(s2), Status::ERR_CC); // NOLINT
+    auto& rinfo = static_cast<session*>(s2)->get_result_info();
+    ASSERT_EQ(rinfo.get_reason_code(), reason_code::CC_OCC_READ_VERIFY);
+
+    ASSERT_EQ(leave(s1), Status::OK);
+    ASSERT_EQ(leave(s2), Status::OK);
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,223 @@
+#include <mutex>
+#include <string>
+
+#include "concurrency_control/include/session.h"
+
+#include "shirakami/interface.h"
+
+#include "test_tool.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class short_promotion_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-concurrency_control-short_tx-"
+                                  "termination-short_promotion_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override {
+        std::call_once(init_google_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override {
+        session::optflag_occ_promotion_threshold = 0;
+        session::optflag_occ_auto_promotion = false;
+        session::optflag_occ_promotion_decay = 1000; // NOLINT
+        fin();
+    }
+
+private:
+    static inline std::once_flag init_google_; // NOLINT
+};
+
+/**
+ * @brief s2 reads a, s1 overwrites a, and s2 fails read verify.
+ */
+static void abort_by_read_verify(Token s1, Token s2, Storage st) {
+    transaction_options to{s2, transaction_options::transaction_type::SHORT};
+    to.set_label("rmw");
+    ASSERT_OK(tx_begin(to));
+    std::string vb{};
+    ASSERT_OK(search_key(s2, st, "a", vb));
+    ASSERT_OK(upsert(s2, st, "b", vb));
+
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, st, "a", "w"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    ASSERT_EQ(commit(s2), Status::ERR_CC); // NOLINT
+    auto& rinfo = static_cast<session*>(s2)->get_result_info();
+    ASSERT_EQ(rinfo.get_reason_code(), reason_code::CC_OCC_READ_VERIFY);
+}
+
+TEST_F(short_promotion_test, recommend_after_aborts) { // NOLINT
+    session::optflag_occ_promotion_threshold = 2;
+    Storage st{};
+    ASSERT_OK(create_storage("", st));
+    Token s1{};
+    Token s2{};
+    ASSERT_OK(enter(s1));
+    ASSERT_OK(enter(s2));
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, st, "a", "v"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    transaction_options to{s2, transaction_options::transaction_type::SHORT};
+    to.set_label("rmw");
+    abort_by_read_verify(s1, s2, st);
+    ASSERT_EQ(recommend_transaction_options(to), Status::WARN_NOT_FOUND);
+    ASSERT_EQ(to.get_transaction_type(),
+              transaction_options::transaction_type::SHORT);
+    abort_by_read_verify(s1, s2, st);
+
+    // promoted with the inferred write preserve
+    ASSERT_OK(recommend_transaction_options(to));
+    ASSERT_EQ(to.get_transaction_type(),
+              transaction_options::transaction_type::LONG);
+    ASSERT_EQ(to.get_write_preserve().size(), 1U);
+    ASSERT_EQ(to.get_write_preserve().at(0), st);
+    promotion_stats stats{};
+    ASSERT_OK(get_promotion_stats("rmw", stats));
+    ASSERT_TRUE(stats.promoted_);
+    ASSERT_EQ(stats.short_aborts_, 2U);
+    ASSERT_EQ(stats.short_commits_, 0U);
+
+    // the promoted tx commits as long tx
+    ASSERT_OK(tx_begin(to));
+    ltx_begin_wait(s2);
+    std::string vb{};
+    ASSERT_OK(search_key(s2, st, "a", vb));
+    ASSERT_OK(upsert(s2, st, "b", vb));
+    ASSERT_OK(commit(s2)); // NOLINT
+    ASSERT_OK(get_promotion_stats("rmw", stats));
+    ASSERT_EQ(stats.long_commits_, 1U);
+
+    // not labeled tx is not tracked
+    ASSERT_EQ(get_promotion_stats("", stats), Status::WARN_NOT_FOUND);
+
+    ASSERT_OK(leave(s1));
+    ASSERT_OK(leave(s2));
+}
+
+TEST_F(short_promotion_test, auto_promotion) { // NOLINT
+    session::optflag_occ_promotion_threshold = 1;
+    session::optflag_occ_auto_promotion = true;
+    Storage st{};
+    ASSERT_OK(create_storage("", st));
+    Token s1{};
+    Token s2{};
+    ASSERT_OK(enter(s1));
+    ASSERT_OK(enter(s2));
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, st, "a", "v"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    abort_by_read_verify(s1, s2, st);
+
+    // the labeled short tx begins as long tx
+    transaction_options to{s2, transaction_options::transaction_type::SHORT};
+    to.set_label("rmw");
+    ASSERT_OK(tx_begin(to));
+    ASSERT_EQ(static_cast<session*>(s2)->get_tx_type(),
+              transaction_options::transaction_type::LONG);
+    ltx_begin_wait(s2);
+    ASSERT_OK(upsert(s2, st, "b", "v"));
+    ASSERT_OK(commit(s2)); // NOLINT
+    promotion_stats stats{};
+    ASSERT_OK(get_promotion_stats("rmw", stats));
+    ASSERT_EQ(stats.auto_promoted_begins_, 1U);
+
+    // other labels are not promoted
+    to.set_label("other");
+    ASSERT_OK(tx_begin(to));
+    ASSERT_EQ(static_cast<session*>(s2)->get_tx_type(),
+              transaction_options::transaction_type::SHORT);
+    ASSERT_OK(commit(s2)); // NOLINT
+
+    ASSERT_OK(leave(s1));
+    ASSERT_OK(leave(s2));
+}
+
+TEST_F(short_promotion_test, demote_after_decay) { // NOLINT
+    session::optflag_occ_promotion_threshold = 1;
+    session::optflag_occ_promotion_decay = 1;
+    Storage st{};
+    ASSERT_OK(create_storage("", st));
+    Token s1{};
+    Token s2{};
+    ASSERT_OK(enter(s1));
+    ASSERT_OK(enter(s2));
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, st, "a", "v"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    abort_by_read_verify(s1, s2, st);
+    transaction_options to{s2, transaction_options::transaction_type::SHORT};
+    to.set_label("rmw");
+    ASSERT_OK(recommend_transaction_options(to));
+
+    // the promotion decays after the long commit
+    ASSERT_OK(tx_begin(to));
+    ltx_begin_wait(s2);
+    ASSERT_OK(upsert(s2, st, "b", "v"));
+    ASSERT_OK(commit(s2)); // NOLINT
+    promotion_stats stats{};
+    ASSERT_OK(get_promotion_stats("rmw", stats));
+    ASSERT_FALSE(stats.promoted_);
+    ASSERT_EQ(stats.demotions_, 1U);
+    to.set_transaction_type(transaction_options::transaction_type::SHORT);
+    to.set_write_preserve({});
+    ASSERT_EQ(recommend_transaction_options(to), Status::WARN_NOT_FOUND);
+
+    ASSERT_OK(leave(s1));
+    ASSERT_OK(leave(s2));
+}
+
+TEST_F(short_promotion_test, infer_wp_from_large_write_set) { // NOLINT
+    session::optflag_occ_promotion_threshold = 1;
+    Storage st{};
+    Storage st2{};
+    ASSERT_OK(create_storage("", st));
+    ASSERT_OK(create_storage("", st2));
+    Token s1{};
+    Token s2{};
+    ASSERT_OK(enter(s1));
+    ASSERT_OK(enter(s2));
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, st, "a", "v"));
+    ASSERT_OK(commit(s1)); // NOLINT
+
+    // the write set is large enough to be kept for batch
+    transaction_options to{s2, transaction_options::transaction_type::SHORT};
+    to.set_label("large");
+    ASSERT_OK(tx_begin(to));
+    std::string vb{};
+    ASSERT_OK(search_key(s2, st, "a", vb));
+    for (std::size_t i = 0; i < 200; ++i) { // NOLINT
+        ASSERT_OK(upsert(s2, st2, std::to_string(i), vb));
+    }
+    ASSERT_TRUE(static_cast<session*>(s2)->get_write_set().get_for_batch());
+
+    ASSERT_OK(tx_begin({s1, transaction_options::transaction_type::SHORT}));
+    ASSERT_OK(upsert(s1, st, "a", "w"));
+    ASSERT_OK(commit(s1)); // NOLINT
+    ASSERT_EQ(commit(s2), Status::ERR_CC); // NOLINT
+
+    ASSERT_OK(recommend_transaction_options(to));
+    ASSERT_EQ(to.get_write_preserve().size(), 1U);
+    ASSERT_EQ(to.get_write_preserve().at(0), st2);
+
+    ASSERT_OK(leave(s1));
+    ASSERT_OK(leave(s2));
+}
+
+} // namespace shirakami::testing
@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 #include "glog/logging.h"
 #include "shirakami/api_diagnostic.h"
+#include "shirakami/api_storage.h"
 #include "shirakami/scheme.h"
 
 namespace shirakami::testing {
@@ -47,4 +48,74 @@ TEST_F(c_termination, abort) { // NOLINT
     ASSERT_EQ(Status::OK, leave(s));
 }
 
+TEST_F(c_termination, commit_read_only) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, create_storage("", st));
+    Token s{};
+    Token s2{};
+    ASSERT_EQ(Status::OK, enter(s));
+    ASSERT_EQ(Status::OK, enter(s2));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, upsert(s, st, "a", "A"));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    // read only, success
+    std::string vb{};
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, search_key(s, st, "a", vb));
+    ASSERT_EQ(vb, "A");
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    // read only, fail read verify
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, search_key(s, st, "a", vb));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s2, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, upsert(s2, st, "a", "B"));
+    ASSERT_EQ(Status::OK, commit(s2)); // NOLINT
+    ASSERT_EQ(Status::ERR_CC, commit(s)); // NOLINT
+
+    // read only, fail node verify
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::WARN_NOT_FOUND, search_key(s, st, "b", vb));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s2, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, upsert(s2, st, "b", "B"));
+    ASSERT_EQ(Status::OK, commit(s2)); // NOLINT
+    ASSERT_EQ(Status::ERR_CC, commit(s)); // NOLINT
+
+    ASSERT_EQ(Status::OK, leave(s));
+    ASSERT_EQ(Status::OK, leave(s2));
+}
+
+TEST_F(c_termination, commit_write_only) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, create_storage("", st));
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, upsert(s, st, "a", "A"));
+    ASSERT_EQ(Status::OK, upsert(s, st, "b", "B"));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, upsert(s, st, "a", "C"));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    std::string vb{};
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, search_key(s, st, "a", vb));
+    ASSERT_EQ(vb, "C");
+    ASSERT_EQ(Status::OK, search_key(s, st, "b", vb));
+    ASSERT_EQ(vb, "B");
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    ASSERT_EQ(Status::OK, leave(s));
+}
+
 } // namespace shirakami::testing
@@ -0,0 +1,101 @@
+
+#include <xmmintrin.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "storage.h"
+#include "test_tool.h"
+#include "tsc.h"
+
+#include "shirakami/interface.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+namespace shirakami::testing {
+
+using namespace shirakami;
+
+class li_single_recovery_non_durable_storage_test
+    : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-datastore-"
+                                  "li_single_recovery_"
+                                  "non_durable_storage_test");
+        // FLAGS_stderrthreshold = 0;
+    }
+
+    void SetUp() override { std::call_once(init_google, call_once_f); }
+
+    void TearDown() override {}
+
+private:
+    static inline std::once_flag init_google; // NOLINT
+};
+
+TEST_F(li_single_recovery_non_durable_storage_test, // NOLINT
+       non_durable_storage_is_absent_after_recovery) { // NOLINT
+    // start
+    std::string log_dir{};
+    int tid = syscall(SYS_gettid); // NOLINT
+    std::uint64_t tsc = rdtsc();
+    log_dir =
+            "/tmp/shirakami-" + std::to_string(tid) + "-" + std::to_string(tsc);
+    init({database_options::open_mode::CREATE, log_dir}); // NOLINT
+
+    Storage st_d{};
+    ASSERT_EQ(Status::OK, create_storage("d", st_d));
+    Storage st_nd{};
+    storage_option options{};
+    options.durable(false);
+    options.payload("p");
+    ASSERT_EQ(Status::OK, create_storage("nd", st_nd, options));
+
+    // options of non-durable storage are kept in memory
+    storage_option out{};
+    ASSERT_EQ(Status::OK, storage_get_options(st_nd, out));
+    ASSERT_EQ(out.payload(), "p");
+    ASSERT_FALSE(out.durable());
+
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, upsert(s, st_d, "a", "A"));
+    ASSERT_EQ(Status::OK, upsert(s, st_nd, "b", "B"));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    std::string vb{};
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, search_key(s, st_nd, "b", vb));
+    ASSERT_EQ(vb, "B");
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    ASSERT_EQ(Status::OK, leave(s));
+
+    fin(false);
+
+    // re-start
+    init({database_options::open_mode::RESTORE, log_dir}); // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, get_storage("d", st));
+    ASSERT_EQ(Status::WARN_NOT_FOUND, get_storage("nd", st));
+    std::vector<Storage> st_list{};
+    ASSERT_EQ(Status::OK, storage::list_storage(st_list));
+    ASSERT_EQ(1, st_list.size());
+
+    ASSERT_EQ(Status::OK, enter(s));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, search_key(s, st_d, "a", vb));
+    ASSERT_EQ(vb, "A");
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    ASSERT_EQ(Status::OK, leave(s));
+
+    fin();
+}
+
+} // namespace shirakami::testing
@@ -0,0 +1,100 @@
+
+#include <mutex>
+#include <string>
+
+#include "shirakami/interface.h"
+
+#include "gtest/gtest.h"
+
+#include "glog/logging.h"
+
+using namespace shirakami;
+
+namespace shirakami::testing {
+
+class storage_truncate_test : public ::testing::Test { // NOLINT
+public:
+    static void call_once_f() {
+        google::InitGoogleLogging("shirakami-test-storage-storage_truncate_test");
+        // FLAGS_stderrthreshold = 0; // output more than INFO
+    }
+
+    void SetUp() override {
+        std::call_once(init_, call_once_f);
+        init(); // NOLINT
+    }
+
+    void TearDown() override { fin(); }
+
+private:
+    static inline std::once_flag init_; // NOLINT
+};
+
+TEST_F(storage_truncate_test, truncate_storage_test) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, create_storage("1", st));
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    for (std::size_t i = 0; i < 100; ++i) { // NOLINT
+        ASSERT_EQ(Status::OK, upsert(s, st, std::to_string(i), "v"));
+    }
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    ASSERT_EQ(Status::OK, truncate_storage(st));
+
+    // records were removed
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    std::string vb{};
+    ASSERT_EQ(Status::WARN_NOT_FOUND, search_key(s, st, "0", vb));
+    ScanHandle hd{};
+    ASSERT_EQ(Status::WARN_NOT_FOUND, open_scan(s, st, "", scan_endpoint::INF,
+                                                "", scan_endpoint::INF, hd));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+
+    // storage is still available
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, insert(s, st, "0", "w"));
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    ASSERT_EQ(Status::OK, search_key(s, st, "0", vb));
+    ASSERT_EQ(vb, "w");
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    Storage out{};
+    ASSERT_EQ(Status::OK, get_storage("1", out));
+    ASSERT_EQ(st, out);
+
+    ASSERT_EQ(Status::OK, leave(s));
+}
+
+TEST_F(storage_truncate_test, truncate_not_existing_storage_test) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, create_storage("1", st));
+    ASSERT_EQ(Status::OK, delete_storage(st));
+    ASSERT_EQ(Status::WARN_INVALID_HANDLE, truncate_storage(st));
+}
+
+TEST_F(storage_truncate_test, delete_storage_async_test) { // NOLINT
+    Storage st{};
+    ASSERT_EQ(Status::OK, create_storage("1", st));
+    Token s{};
+    ASSERT_EQ(Status::OK, enter(s));
+    ASSERT_EQ(Status::OK,
+              tx_begin({s, transaction_options::transaction_type::SHORT}));
+    for (std::size_t i = 0; i < 100; ++i) { // NOLINT
+        ASSERT_EQ(Status::OK, upsert(s, st, std::to_string(i), "v"));
+    }
+    ASSERT_EQ(Status::OK, commit(s)); // NOLINT
+    ASSERT_EQ(Status::OK, leave(s));
+
+    ASSERT_EQ(Status::OK, delete_storage(st, true));
+    Storage out{};
+    ASSERT_EQ(Status::WARN_NOT_FOUND, get_storage("1", out));
+    ASSERT_EQ(Status::WARN_INVALID_HANDLE, delete_storage(st, true));
+}
+
+} // namespace shirakami::testing
@@ -105,4 +105,27 @@ TEST_F(tid_word_test, absent_is_stronger_than_lock) {
     EXPECT_LT(t1, t2);
 }
 
+TEST_F(tid_word_test, lock_contention_policy) { // NOLINT
+    for (auto policy :
+         {lock_contention_policy::SPIN, lock_contention_policy::BACKOFF,
+          lock_contention_policy::BOUNDED_SPIN,
+          lock_contention_policy::NO_WAIT}) {
+        // not locked, so every policy acquires it.
+        tid_word tid{};
+        ASSERT_TRUE(tid.lock(policy, 10));
+        ASSERT_TRUE(tid.get_lock());
+        ASSERT_FALSE(tid.get_lock_by_gc());
+        tid.unlock();
+        ASSERT_FALSE(tid.get_lock());
+    }
+
+    // locked, so bounded spin and no wait give up.
+    tid_word tid{};
+    tid.lock();
+    ASSERT_FALSE(tid.lock(lock_contention_policy::BOUNDED_SPIN, 10));
+    ASSERT_FALSE(tid.lock(lock_contention_policy::NO_WAIT, 0));
+    ASSERT_TRUE(tid.get_lock());
+    tid.unlock();
+}
+
 } // namespace shirakami::testing
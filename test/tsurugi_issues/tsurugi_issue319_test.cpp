@@ -79,16 +79,16 @@ TEST_F(tsurugi_issue319, check_read_write_range_after_submit_commit) { // NOLINT
         bool was_checked{false};
         for (auto&& elem : read_plan::get_cont()) {
             if (elem.first == t2_id) {
-                auto plist = std::get<0>(elem.second);
-                ASSERT_EQ(plist.size(), 1);
-                ASSERT_EQ(st, std::get<0>((*plist.begin())));
-                ASSERT_EQ(true, std::get<1>((*plist.begin())));
-                ASSERT_EQ("a", std::get<2>((*plist.begin())));
+                auto const& pranges = elem.second.pranges_;
+                ASSERT_EQ(elem.second.pstorages_.size(), 0);
+                ASSERT_EQ(pranges.size(), 1);
+                ASSERT_EQ(st, std::get<0>(pranges.front()));
+                ASSERT_EQ("a", std::get<1>(pranges.front()));
                 ASSERT_EQ(scan_endpoint::INCLUSIVE,
-                          std::get<3>((*plist.begin())));
-                ASSERT_EQ("c", std::get<4>((*plist.begin())));
+                          std::get<2>(pranges.front()));
+                ASSERT_EQ("c", std::get<3>(pranges.front()));
                 ASSERT_EQ(scan_endpoint::INCLUSIVE,
-                          std::get<5>((*plist.begin())));
+                          std::get<4>(pranges.front()));
                 was_checked = true;
             }
         }